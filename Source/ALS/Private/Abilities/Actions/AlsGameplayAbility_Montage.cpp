@@ -3,6 +3,7 @@
 #include "Abilities/Actions/AlsGameplayAbility_Montage.h"
 #include "AlsAbilitySystemComponent.h"
 #include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsGameplayAbility_Montage)
 
@@ -12,6 +13,29 @@
 //
 // --------------------------------------------------------------------------------------------------------------------------------------------------------
 
+void UAlsGameplayAbility_Montage::PostLoad()
+{
+	Super::PostLoad();
+
+#if WITH_EDITORONLY_DATA
+	if (MontageToPlay_DEPRECATED != nullptr)
+	{
+		SoftMontageToPlay = MontageToPlay_DEPRECATED;
+		MontageToPlay_DEPRECATED = nullptr;
+	}
+#endif
+}
+
+void UAlsGameplayAbility_Montage::GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	Super::GetPreloadAssets(OutAssets);
+
+	if (!SoftMontageToPlay.IsNull())
+	{
+		OutAssets.Add(SoftMontageToPlay.ToSoftObjectPath());
+	}
+}
+
 void UAlsGameplayAbility_Montage::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo *ActorInfo,
 												  const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData *TriggerEventData)
 {
@@ -20,7 +44,7 @@ void UAlsGameplayAbility_Montage::ActivateAbility(const FGameplayAbilitySpecHand
 		return;
 	}
 
-	PlayMontage(ActivationInfo, MontageToPlay, PlayRate, SectionName, StartTime, Handle, ActorInfo);
+	PlayMontage(ActivationInfo, SoftMontageToPlay.LoadSynchronous(), PlayRate, SectionName, StartTime, Handle, ActorInfo);
 
 	if (CurrentMotangeDuration <= 0.0f)
 	{
@@ -67,7 +67,7 @@ void UAlsGameplayAbility_MontageBase::GetGameplayEffectsWhileAnimating(TArray<co
 bool UAlsGameplayAbility_MontageBase::PlayMontage(const FGameplayAbilityActivationInfo& ActivationInfo, const FAlsPlayMontageParameter& Parameter,
 												  const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo)
 {
-	return PlayMontage(ActivationInfo, Parameter.MontageToPlay, Parameter.PlayRate, Parameter.SectionName, Parameter.StartTime, Handle, ActorInfo);
+	return PlayMontage(ActivationInfo, Parameter.LoadMontage(), Parameter.PlayRate, Parameter.SectionName, Parameter.StartTime, Handle, ActorInfo);
 }
 
 bool UAlsGameplayAbility_MontageBase::PlayMontage(UAnimMontage* Montage, float PlayRate, FName SectionName, float StartTime)
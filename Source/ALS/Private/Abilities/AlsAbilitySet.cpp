@@ -16,6 +16,16 @@ void FAlsAbilitySet_GrantedHandles::AddAbilitySpecHandle(const FGameplayAbilityS
 	}
 }
 
+void FAlsAbilitySet_GrantedHandles::AddAbilitySpecHandles(const TConstArrayView<FGameplayAbilitySpecHandle> Handles)
+{
+	AbilitySpecHandles.Reserve(AbilitySpecHandles.Num() + Handles.Num());
+
+	for (const auto& Handle : Handles)
+	{
+		AddAbilitySpecHandle(Handle);
+	}
+}
+
 void FAlsAbilitySet_GrantedHandles::AddGameplayEffectHandle(const FActiveGameplayEffectHandle& Handle)
 {
 	if (Handle.IsValid())
@@ -79,7 +89,10 @@ void UAlsAbilitySet::GiveToAbilitySystem(UAlsAbilitySystemComponent* AlsAsc, UOb
 		return;
 	}
 
-	// Grant the gameplay abilities.
+	// Grant the gameplay abilities in a single batch.
+	TArray<FGameplayAbilitySpec> AbilitySpecs;
+	AbilitySpecs.Reserve(GrantedGameplayAbilities.Num());
+
 	for (int32 AbilityIndex{0}; AbilityIndex < GrantedGameplayAbilities.Num(); ++AbilityIndex)
 	{
 		const auto& AbilityToGrant{GrantedGameplayAbilities[AbilityIndex]};
@@ -92,15 +105,16 @@ void UAlsAbilitySet::GiveToAbilitySystem(UAlsAbilitySystemComponent* AlsAsc, UOb
 
 		auto* AbilityCdo{AbilityToGrant.Ability->GetDefaultObject<UAlsGameplayAbility>()};
 
-		FGameplayAbilitySpec AbilitySpec{AbilityCdo, AbilityToGrant.AbilityLevel};
+		auto& AbilitySpec{AbilitySpecs.Emplace_GetRef(AbilityCdo, AbilityToGrant.AbilityLevel)};
 		AbilitySpec.SourceObject = SourceObject;
+	}
 
-		const auto AbilitySpecHandle{AlsAsc->GiveAbility(AbilitySpec)};
+	TArray<FGameplayAbilitySpecHandle> AbilitySpecHandles;
+	AlsAsc->GiveAbilities(AbilitySpecs, AbilitySpecHandles);
 
-		if (OutGrantedHandles)
-		{
-			OutGrantedHandles->AddAbilitySpecHandle(AbilitySpecHandle);
-		}
+	if (OutGrantedHandles)
+	{
+		OutGrantedHandles->AddAbilitySpecHandles(AbilitySpecHandles);
 	}
 
 	// Grant the gameplay effects.
@@ -143,3 +157,14 @@ void UAlsAbilitySet::GiveToAbilitySystem(UAlsAbilitySystemComponent* AlsAsc, UOb
 		}
 	}
 }
+
+void UAlsAbilitySet::GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	for (const auto& AbilityToGrant : GrantedGameplayAbilities)
+	{
+		if (IsValid(AbilityToGrant.Ability))
+		{
+			AbilityToGrant.Ability->GetDefaultObject<UAlsGameplayAbility>()->GetPreloadAssets(OutAssets);
+		}
+	}
+}
@@ -5,10 +5,27 @@
 #include "AlsCharacterMovementComponent.h"
 #include "AlsAbilitySystemComponent.h"
 #include "AlsMotionWarpingComponent.h"
+#include "Animation/AnimMontage.h"
 #include "Engine/InputDelegateBinding.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsGameplayAbility)
 
+UAnimMontage* FAlsPlayMontageParameter::LoadMontage() const
+{
+	return SoftMontageToPlay.LoadSynchronous();
+}
+
+void FAlsPlayMontageParameter::PostSerialize(const FArchive& Archive)
+{
+#if WITH_EDITORONLY_DATA
+	if (Archive.IsLoading() && MontageToPlay_DEPRECATED != nullptr)
+	{
+		SoftMontageToPlay = MontageToPlay_DEPRECATED;
+		MontageToPlay_DEPRECATED = nullptr;
+	}
+#endif
+}
+
 UAlsGameplayAbility::UAlsGameplayAbility(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
@@ -50,6 +67,17 @@ UWorld* UAlsGameplayAbility::GetWorld() const
 	return nullptr;
 }
 
+void UAlsGameplayAbility::GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	for (const auto& Asset : PreloadAssets)
+	{
+		if (!Asset.IsNull())
+		{
+			OutAssets.Add(Asset.ToSoftObjectPath());
+		}
+	}
+}
+
 void UAlsGameplayAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
 										  const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
@@ -81,10 +109,11 @@ bool UAlsGameplayAbility::PlayMontage(const FGameplayAbilityActivationInfo& Acti
 									  const FAlsPlayMontageParameter& Parameter)
 {
 	auto* const AbilitySystemComponent = ActorInfo->AbilitySystemComponent.Get();
+	auto* const Montage = Parameter.LoadMontage();
 
-	if (Parameter.MontageToPlay && AbilitySystemComponent)
+	if (Montage && AbilitySystemComponent)
 	{
-		if (AbilitySystemComponent->PlayMontage(this, ActivationInfo, Parameter.MontageToPlay, Parameter.PlayRate, Parameter.SectionName, Parameter.StartTime))
+		if (AbilitySystemComponent->PlayMontage(this, ActivationInfo, Montage, Parameter.PlayRate, Parameter.SectionName, Parameter.StartTime))
 		{
 			return true;
 		}
@@ -6,6 +6,7 @@
 #include "Animation/AnimMontage.h"
 #include "RootMotionSources/AlsRootMotionSource_Mantling.h"
 #include "Abilities/Actions/AlsGameplayAbility_Mantling.h"
+#include "Utility/AlsLog.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAbilitySystemComponent)
 
@@ -21,11 +22,95 @@ void UAlsAbilitySystemComponent::OnRegister()
 	auto* Character{Cast<AAlsCharacter>(GetOwner())};
 	if (IsValid(Character))
 	{
-		Character->OnRefresh.AddUObject(this, &ThisClass::OnRefresh);
+		bBlueprintRefreshImplemented = GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ThisClass, OnRefresh));
+		Character->OnRefresh.AddUObject(this, &ThisClass::HandleRefresh);
 		Character->OnContollerChanged.AddUObject(this, &ThisClass::OnControllerChanged);
 	}
 }
 
+void UAlsAbilitySystemComponent::HandleRefresh(const float DeltaTime)
+{
+	if (bBlueprintRefreshImplemented)
+	{
+		OnRefresh(DeltaTime);
+	}
+	else
+	{
+		OnRefresh_Implementation(DeltaTime);
+	}
+}
+
+void UAlsAbilitySystemComponent::OnTagUpdated(const FGameplayTag& Tag, const bool bTagExists)
+{
+	Super::OnTagUpdated(Tag, bTagExists);
+
+	auto* Character{Cast<AAlsCharacter>(GetOwner())};
+	if (IsValid(Character))
+	{
+		Character->MarkGameplayTagsChanged();
+	}
+}
+
+void UAlsAbilitySystemComponent::GiveAbilities(const TConstArrayView<FGameplayAbilitySpec> Specs, TArray<FGameplayAbilitySpecHandle>& OutHandles)
+{
+	if (!IsOwnerActorAuthoritative())
+	{
+		UE_LOG(LogAls, Error, TEXT("%hs: Abilities can only be given on the authority."), __FUNCTION__);
+		return;
+	}
+
+	OutHandles.Reserve(OutHandles.Num() + Specs.Num());
+
+	if (AbilityScopeLockCount > 0)
+	{
+		// The ability list is already locked by the caller, so the specs have to go through the pending adds anyway.
+
+		for (const auto& Spec : Specs)
+		{
+			OutHandles.Add(GiveAbility(Spec));
+		}
+
+		return;
+	}
+
+	{
+		ABILITYLIST_SCOPE_LOCK();
+
+		ActivatableAbilities.Items.Reserve(ActivatableAbilities.Items.Num() + Specs.Num());
+
+		for (const auto& Spec : Specs)
+		{
+			if (!IsValid(Spec.Ability))
+			{
+				UE_LOG(LogAls, Error, TEXT("%hs: Invalid ability spec ability, skipping."), __FUNCTION__);
+				continue;
+			}
+
+			// Same as GiveAbility(), except that the ability list is marked dirty only once for the whole batch.
+
+			auto& OwnedSpec{ActivatableAbilities.Items.Add_GetRef(Spec)};
+
+			if (OwnedSpec.Ability->GetInstancingPolicy() == EGameplayAbilityInstancingPolicy::InstancedPerActor)
+			{
+				CreateNewInstanceOfAbility(OwnedSpec, Spec.Ability);
+			}
+
+			OnGiveAbility(OwnedSpec);
+
+			// Only assigns the replication id of the new item, the array itself is marked dirty after the loop.
+			ActivatableAbilities.MarkItemDirty(OwnedSpec);
+			AbilitySpecDirtiedCallbacks.Broadcast(OwnedSpec);
+
+			OutHandles.Add(OwnedSpec.Handle);
+		}
+
+		ActivatableAbilities.MarkArrayDirty();
+	}
+
+	// Send the whole batch in a single replication update.
+	ForceReplication();
+}
+
 void UAlsAbilitySystemComponent::BindAbilityActivationInput(UEnhancedInputComponent* EnhancedInputComponent, const UInputAction* Action, ETriggerEvent TriggerEvent,
 														    const FGameplayTag& InputTag)
 {
@@ -51,6 +136,8 @@ void UAlsAbilitySystemComponent::UnbindAbilityInputs(UEnhancedInputComponent* En
 
 void UAlsAbilitySystemComponent::ActivateOnInputAction(FGameplayTag InputTag)
 {
+	OnInputActivation.Broadcast(InputTag);
+
 	TryActivateAbilitiesBySingleTag(InputTag);
 }
 
@@ -12,6 +12,7 @@
 #include "Components/CapsuleComponent.h"
 #include "Curves/CurveFloat.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Utility/AlsAnimationMetadata.h"
 #include "Utility/AlsConstants.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsUtility.h"
@@ -24,6 +25,8 @@ void UAlsAnimationInstance::NativeInitializeAnimation()
 
 	Character = Cast<AAlsCharacter>(GetOwningActor());
 
+	CurrentGameplayTagsGeneration.Reset();
+
 #if WITH_EDITOR
 	if (!GetWorld()->IsGameWorld() && !Character.IsValid())
 	{
@@ -86,7 +89,10 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 	bDisplayDebugTraces = UAlsUtility::ShouldDisplayDebugForActor(Character.Get(), UAlsConstants::TracesDebugDisplayName());
 #endif
 
-	Character->GetOwnedGameplayTags(CurrentGameplayTags);
+	RefreshGameplayTagsOnGameThread();
+
+	bDedicatedServerProfile = Settings->General.bUseDedicatedServerProfile && Character->IsNetMode(NM_DedicatedServer);
+
 	FaceRotationMode = Character->GetRotationMode();
 	if (FaceRotationMode != AlsRotationModeTags::Aiming)
 	{
@@ -108,7 +114,29 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 	RefreshGroundedOnGameThread();
 	RefreshInAirOnGameThread();
 
-	RefreshFeetOnGameThread();
+	if (!bDedicatedServerProfile || Settings->General.bRefreshFeetOnDedicatedServer)
+	{
+		RefreshFeetOnGameThread();
+	}
+}
+
+void UAlsAnimationInstance::RefreshGameplayTagsOnGameThread()
+{
+	// The tag container is only rebuilt when the character's tags have actually changed. Editor
+	// preview uses the default character object, so there the tags are always refreshed.
+
+	const auto Generation{Character->GetGameplayTagsGeneration()};
+
+	if (CurrentGameplayTagsGeneration.IsSet() && CurrentGameplayTagsGeneration.GetValue() == Generation && GetWorld()->IsGameWorld())
+	{
+		return;
+	}
+
+	CurrentGameplayTagsGeneration = Generation;
+	CurrentGameplayTagsVersion = (CurrentGameplayTagsVersion + 1) & MAX_int32;
+
+	Character->GetOwnedGameplayTags(CurrentGameplayTags);
+	CurrentStateTagBits = AlsStateTagBits::FromGameplayTags(CurrentGameplayTags);
 }
 
 void UAlsAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTime)
@@ -123,7 +151,7 @@ void UAlsAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTim
 		return;
 	}
 
-	if (LayeringAnimInstance.IsValid())
+	if (LayeringAnimInstance.IsValid() && !bDedicatedServerProfile)
 	{
 		LayeringAnimInstance->Refresh();
 	}
@@ -143,11 +171,19 @@ void UAlsAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTim
 	RefreshGrounded(DeltaTime);
 	RefreshInAir(DeltaTime);
 
-	RefreshFeet(DeltaTime);
+	if (!bDedicatedServerProfile || Settings->General.bRefreshFeetOnDedicatedServer)
+	{
+		RefreshFeet(DeltaTime);
+	}
 
 	RefreshTransitions();
 	RefreshRotateInPlace(DeltaTime);
 	RefreshTurnInPlace(DeltaTime);
+
+	if (!bDedicatedServerProfile)
+	{
+		RefreshControlRigInput();
+	}
 }
 
 void UAlsAnimationInstance::NativePostUpdateAnimation()
@@ -184,18 +220,24 @@ FAnimInstanceProxy* UAlsAnimationInstance::CreateAnimInstanceProxy()
 
 FAlsControlRigInput UAlsAnimationInstance::GetControlRigInput() const
 {
-	return {
-		GroundedState.VelocityBlend.ForwardAmount,
-		GroundedState.VelocityBlend.BackwardAmount,
-		ViewAnimInstance.IsValid() ? ViewAnimInstance->SpineRotation.YawAngle : 0.0f,
-		FeetState.Left.IkRotation,
-		FeetState.Left.IkLocation,
-		FeetState.Left.IkAmount,
-		FeetState.Right.IkRotation,
-		FeetState.Right.IkLocation,
-		FeetState.Right.IkAmount,
-		FeetState.MinMaxPelvisOffsetZ,
-	};
+	return ControlRigInput;
+}
+
+void UAlsAnimationInstance::RefreshControlRigInput()
+{
+	ControlRigInput.VelocityBlendForwardAmount = GroundedState.VelocityBlend.ForwardAmount;
+	ControlRigInput.VelocityBlendBackwardAmount = GroundedState.VelocityBlend.BackwardAmount;
+	ControlRigInput.SpineYawAngle = ViewAnimInstance.IsValid() ? ViewAnimInstance->SpineRotation.YawAngle : 0.0f;
+
+	ControlRigInput.FootLeftIkRotation = FeetState.Left.IkRotation;
+	ControlRigInput.FootLeftIkLocation = FeetState.Left.IkLocation;
+	ControlRigInput.FootLeftIkAmount = FeetState.Left.IkAmount;
+
+	ControlRigInput.FootRightIkRotation = FeetState.Right.IkRotation;
+	ControlRigInput.FootRightIkLocation = FeetState.Right.IkLocation;
+	ControlRigInput.FootRightIkAmount = FeetState.Right.IkAmount;
+
+	ControlRigInput.MinMaxPelvisOffsetZ = FeetState.MinMaxPelvisOffsetZ;
 }
 
 void UAlsAnimationInstance::RefreshMovementBaseOnGameThread()
@@ -266,7 +308,7 @@ void UAlsAnimationInstance::RefreshPose()
 
 bool UAlsAnimationInstance::IsSpineRotationAllowed()
 {
-	return !CurrentGameplayTags.HasTag(AlsRotationModeTags::VelocityDirection);
+	return !HasStateTag(EAlsStateTagBits::VelocityDirection);
 }
 
 void UAlsAnimationInstance::RefreshLocomotionOnGameThread()
@@ -325,7 +367,7 @@ void UAlsAnimationInstance::RefreshGrounded(const float DeltaTime)
 	GroundedState.SprintBlockAmount = GetCurveValueClamped01(UAlsConstants::SprintBlockCurveName());
 	GroundedState.HipsDirectionLockAmount = FMath::Clamp(GetCurveValue(UAlsConstants::HipsDirectionLockCurveName()), -1.0f, 1.0f);
 
-	if (!CurrentGameplayTags.HasTag(AlsLocomotionModeTags::Grounded))
+	if (!HasStateTag(EAlsStateTagBits::Grounded))
 	{
 		GroundedState.VelocityBlend.bReinitializationRequired = true;
 		GroundedState.SprintTime = 0.0f;
@@ -338,6 +380,12 @@ void UAlsAnimationInstance::RefreshGrounded(const float DeltaTime)
 		return;
 	}
 
+	if (bDedicatedServerProfile)
+	{
+		// Everything below only drives the look of the locomotion blend spaces.
+		return;
+	}
+
 	// Calculate the relative acceleration amount. This value represents the current amount of acceleration / deceleration
 	// relative to the character rotation. It is normalized to a range of -1 to 1 so that -1 equals the
 	// max braking deceleration and 1 equals the max acceleration of the character movement component.
@@ -377,7 +425,7 @@ void UAlsAnimationInstance::RefreshMovementDirection()
 	// Calculate the movement direction. This value represents the direction the character is moving relative
 	// to the camera and is used in the cycle blending to blend to the appropriate directional states.
 
-	if (CurrentGameplayTags.HasTag(AlsGaitTags::Sprinting))
+	if (HasStateTag(EAlsStateTagBits::Sprinting))
 	{
 		GroundedState.MovementDirection = EAlsMovementDirection::Forward;
 		return;
@@ -452,7 +500,7 @@ void UAlsAnimationInstance::RefreshRotationYawOffsets()
 
 void UAlsAnimationInstance::RefreshSprint(const FVector3f& RelativeAccelerationAmount, const float DeltaTime)
 {
-	if (!CurrentGameplayTags.HasTag(AlsGaitTags::Sprinting))
+	if (!HasStateTag(EAlsStateTagBits::Sprinting))
 	{
 		GroundedState.SprintTime = 0.0f;
 		GroundedState.SprintAccelerationAmount = 0.0f;
@@ -500,7 +548,7 @@ void UAlsAnimationInstance::RefreshWalkRunBlendAmount()
 {
 	// Calculate the walk run blend amount. This value is used within the blend spaces to blend between walking and running.
 
-	GroundedState.WalkRunBlendAmount = CurrentGameplayTags.HasTag(AlsGaitTags::Walking) ? 0.0f : 1.0f;
+	GroundedState.WalkRunBlendAmount = HasStateTag(EAlsStateTagBits::Walking) ? 0.0f : 1.0f;
 }
 
 void UAlsAnimationInstance::RefreshStandingPlayRate()
@@ -586,7 +634,7 @@ void UAlsAnimationInstance::RefreshInAir(const float DeltaTime)
 		InAirState.JumpPlayRate = UAlsMath::LerpClamped(MinPlayRate, MaxPlayRate, LocomotionState.Speed / ReferenceSpeed);
 	}
 
-	if (!CurrentGameplayTags.HasTag(AlsLocomotionModeTags::InAir))
+	if (!HasStateTag(EAlsStateTagBits::InAir))
 	{
 		return;
 	}
@@ -595,6 +643,11 @@ void UAlsAnimationInstance::RefreshInAir(const float DeltaTime)
 
 	InAirState.VerticalVelocity = UE_REAL_TO_FLOAT(LocomotionState.Velocity.Z);
 
+	if (bDedicatedServerProfile)
+	{
+		return;
+	}
+
 	RefreshGroundPredictionAmount();
 
 	RefreshInAirLeanAmount(DeltaTime);
@@ -754,13 +807,15 @@ void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
 
 	FeetState.MinMaxPelvisOffsetZ = FVector2f::ZeroVector;
 
-	const auto ComponentTransformInverse{GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform().Inverse()};
+	// Values that are the same for all feet are calculated only once, so each foot only does its own work.
+
+	const auto Context{MakeFeetRefreshContext(DeltaTime)};
 
 	RefreshFoot(FeetState.Left, UAlsConstants::FootLeftIkCurveName(), UAlsConstants::FootLeftLockCurveName(),
-				Settings->Feet.LeftFootLimits, ComponentTransformInverse, DeltaTime);
+				Settings->Feet.LeftFootLimits, Context);
 
 	RefreshFoot(FeetState.Right, UAlsConstants::FootRightIkCurveName(), UAlsConstants::FootRightLockCurveName(),
-				Settings->Feet.RightFootLimits, ComponentTransformInverse, DeltaTime);
+				Settings->Feet.RightFootLimits, Context);
 
 	FeetState.MinMaxPelvisOffsetZ.X = UE_REAL_TO_FLOAT(
 		FMath::Min(FeetState.Left.OffsetTargetLocationZ, FeetState.Right.OffsetTargetLocationZ) / LocomotionState.Scale);
@@ -769,60 +824,74 @@ void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
 		FMath::Max(FeetState.Left.OffsetTargetLocationZ, FeetState.Right.OffsetTargetLocationZ) / LocomotionState.Scale);
 }
 
+FAlsFeetRefreshContext UAlsAnimationInstance::MakeFeetRefreshContext(const float DeltaTime) const
+{
+	FAlsFeetRefreshContext Context;
+
+	Context.ComponentTransform = GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform();
+	Context.ComponentTransformInverse = Context.ComponentTransform.Inverse();
+	Context.MovementBaseRotationInverse = MovementBase.Rotation.Inverse();
+	Context.DeltaTime = DeltaTime;
+
+	// Due to network smoothing, we assume that teleportation occurs over a short period of time, not
+	// in one frame, since after accepting the teleportation event, the character can still be moved for
+	// some indefinite time, and this must be taken into account in order to avoid foot locking glitches.
+
+	Context.bTeleportedRecently = !bPendingUpdate && GetWorld()->TimeSince(TeleportedTime) <= 0.2f;
+
+	Context.bFootLockInhibited = IsFootLockInhibited();
+	Context.bGrounded = HasStateTag(EAlsStateTagBits::Grounded);
+	Context.bInAir = HasStateTag(EAlsStateTagBits::InAir);
+
+	return Context;
+}
+
 void UAlsAnimationInstance::RefreshFoot(FAlsFootState& FootState, const FName& FootIkCurveName,
 										const FName& FootLockCurveName, const FAlsFootLimitsSettings& LimitsSettings,
-										const FTransform& ComponentTransformInverse, const float DeltaTime) const
+										const FAlsFeetRefreshContext& Context) const
 {
 	FootState.IkAmount = GetCurveValueClamped01(FootIkCurveName);
 
-	ProcessFootLockTeleport(FootState);
+	ProcessFootLockTeleport(FootState, Context);
 
-	ProcessFootLockBaseChange(FootState, ComponentTransformInverse);
+	ProcessFootLockBaseChange(FootState, Context);
 
 	auto FinalLocation{FootState.TargetLocation};
 	auto FinalRotation{FootState.TargetRotation};
 
-	RefreshFootLock(FootState, FootLockCurveName, ComponentTransformInverse, DeltaTime, FinalLocation, FinalRotation);
+	RefreshFootLock(FootState, FootLockCurveName, Context, FinalLocation, FinalRotation);
 
 	const auto PreviousFinalRotation{FinalRotation};
-	RefreshFootOffset(FootState, DeltaTime, FinalLocation, FinalRotation);
+	RefreshFootOffset(FootState, Context, FinalLocation, FinalRotation);
 
 	// Prevent the foot from assuming an unnatural pose when on a highly
 	// sloped surface by limiting its rotation after applying a foot offset.
 
 	LimitFootRotation(LimitsSettings, PreviousFinalRotation, FinalRotation);
 
-	FootState.IkLocation = ComponentTransformInverse.TransformPosition(FinalLocation);
-	FootState.IkRotation = ComponentTransformInverse.TransformRotation(FinalRotation);
+	FootState.IkLocation = Context.ComponentTransformInverse.TransformPosition(FinalLocation);
+	FootState.IkRotation = Context.ComponentTransformInverse.TransformRotation(FinalRotation);
 }
 
-void UAlsAnimationInstance::ProcessFootLockTeleport(FAlsFootState& FootState) const
+void UAlsAnimationInstance::ProcessFootLockTeleport(FAlsFootState& FootState, const FAlsFeetRefreshContext& Context) const
 {
-	// Due to network smoothing, we assume that teleportation occurs over a short period of time, not
-	// in one frame, since after accepting the teleportation event, the character can still be moved for
-	// some indefinite time, and this must be taken into account in order to avoid foot locking glitches.
-
-	if (bPendingUpdate || GetWorld()->TimeSince(TeleportedTime) > 0.2f ||
-		!FAnimWeight::IsRelevant(FootState.IkAmount * FootState.LockAmount))
+	if (!Context.bTeleportedRecently || !FAnimWeight::IsRelevant(FootState.IkAmount * FootState.LockAmount))
 	{
 		return;
 	}
 
-	const auto& ComponentTransform{GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform()};
-
-	FootState.LockLocation = ComponentTransform.TransformPosition(FootState.LockComponentRelativeLocation);
-	FootState.LockRotation = ComponentTransform.TransformRotation(FootState.LockComponentRelativeRotation);
+	FootState.LockLocation = Context.ComponentTransform.TransformPosition(FootState.LockComponentRelativeLocation);
+	FootState.LockRotation = Context.ComponentTransform.TransformRotation(FootState.LockComponentRelativeRotation);
 
 	if (MovementBase.bHasRelativeLocation)
 	{
-		const auto BaseRotationInverse{MovementBase.Rotation.Inverse()};
-
-		FootState.LockMovementBaseRelativeLocation = BaseRotationInverse.RotateVector(FootState.LockLocation - MovementBase.Location);
-		FootState.LockMovementBaseRelativeRotation = BaseRotationInverse * FootState.LockRotation;
+		FootState.LockMovementBaseRelativeLocation = Context.MovementBaseRotationInverse.RotateVector(
+			FootState.LockLocation - MovementBase.Location);
+		FootState.LockMovementBaseRelativeRotation = Context.MovementBaseRotationInverse * FootState.LockRotation;
 	}
 }
 
-void UAlsAnimationInstance::ProcessFootLockBaseChange(FAlsFootState& FootState, const FTransform& ComponentTransformInverse) const
+void UAlsAnimationInstance::ProcessFootLockBaseChange(FAlsFootState& FootState, const FAlsFeetRefreshContext& Context) const
 {
 	if ((!bPendingUpdate && !MovementBase.bBaseChanged) || !FAnimWeight::IsRelevant(FootState.IkAmount * FootState.LockAmount))
 	{
@@ -835,15 +904,14 @@ void UAlsAnimationInstance::ProcessFootLockBaseChange(FAlsFootState& FootState,
 		FootState.LockRotation = FootState.TargetRotation;
 	}
 
-	FootState.LockComponentRelativeLocation = ComponentTransformInverse.TransformPosition(FootState.LockLocation);
-	FootState.LockComponentRelativeRotation = ComponentTransformInverse.TransformRotation(FootState.LockRotation);
+	FootState.LockComponentRelativeLocation = Context.ComponentTransformInverse.TransformPosition(FootState.LockLocation);
+	FootState.LockComponentRelativeRotation = Context.ComponentTransformInverse.TransformRotation(FootState.LockRotation);
 
 	if (MovementBase.bHasRelativeLocation)
 	{
-		const auto BaseRotationInverse{MovementBase.Rotation.Inverse()};
-
-		FootState.LockMovementBaseRelativeLocation = BaseRotationInverse.RotateVector(FootState.LockLocation - MovementBase.Location);
-		FootState.LockMovementBaseRelativeRotation = BaseRotationInverse * FootState.LockRotation;
+		FootState.LockMovementBaseRelativeLocation = Context.MovementBaseRotationInverse.RotateVector(
+			FootState.LockLocation - MovementBase.Location);
+		FootState.LockMovementBaseRelativeRotation = Context.MovementBaseRotationInverse * FootState.LockRotation;
 	}
 	else
 	{
@@ -853,12 +921,11 @@ void UAlsAnimationInstance::ProcessFootLockBaseChange(FAlsFootState& FootState,
 }
 
 void UAlsAnimationInstance::RefreshFootLock(FAlsFootState& FootState, const FName& FootLockCurveName,
-											const FTransform& ComponentTransformInverse, const float DeltaTime,
-											FVector& FinalLocation, FQuat& FinalRotation) const
+											const FAlsFeetRefreshContext& Context, FVector& FinalLocation, FQuat& FinalRotation) const
 {
 	auto NewFootLockAmount{GetCurveValueClamped01(FootLockCurveName)};
 
-	if (LocomotionState.bMovingSmooth || !CurrentGameplayTags.HasTag(AlsLocomotionModeTags::Grounded))
+	if (LocomotionState.bMovingSmooth || !Context.bGrounded)
 	{
 		// Smoothly disable foot locking if the character is moving or in the air,
 		// instead of relying on the curve value from the animation blueprint.
@@ -869,7 +936,7 @@ void UAlsAnimationInstance::RefreshFootLock(FAlsFootState& FootState, const FNam
 		NewFootLockAmount = bPendingUpdate
 								? 0.0f
 								: FMath::Max(0.0f, FMath::Min(NewFootLockAmount,
-															  FootState.LockAmount - DeltaTime *
+															  FootState.LockAmount - Context.DeltaTime *
 															  (LocomotionState.bMovingSmooth
 																   ? MovingDecreaseSpeed
 																   : NotGroundedDecreaseSpeed)));
@@ -914,16 +981,15 @@ void UAlsAnimationInstance::RefreshFootLock(FAlsFootState& FootState, const FNam
 				FootState.LockLocation = FinalLocation;
 				FootState.LockRotation = FinalRotation;
 
-				FootState.LockComponentRelativeLocation = ComponentTransformInverse.TransformPosition(FootState.LockLocation);
-				FootState.LockComponentRelativeRotation = ComponentTransformInverse.TransformRotation(FootState.LockRotation);
+				FootState.LockComponentRelativeLocation = Context.ComponentTransformInverse.TransformPosition(FootState.LockLocation);
+				FootState.LockComponentRelativeRotation = Context.ComponentTransformInverse.TransformRotation(FootState.LockRotation);
 			}
 
 			if (MovementBase.bHasRelativeLocation)
 			{
-				const auto BaseRotationInverse{MovementBase.Rotation.Inverse()};
-
-				FootState.LockMovementBaseRelativeLocation = BaseRotationInverse.RotateVector(FinalLocation - MovementBase.Location);
-				FootState.LockMovementBaseRelativeRotation = BaseRotationInverse * FinalRotation;
+				FootState.LockMovementBaseRelativeLocation = Context.MovementBaseRotationInverse.RotateVector(
+					FinalLocation - MovementBase.Location);
+				FootState.LockMovementBaseRelativeRotation = Context.MovementBaseRotationInverse * FinalRotation;
 			}
 			else
 			{
@@ -939,22 +1005,19 @@ void UAlsAnimationInstance::RefreshFootLock(FAlsFootState& FootState, const FNam
 		FootState.LockAmount = NewFootLockAmount;
 	}
 
-	if (IsFootLockInhibited())
+	if (Context.bFootLockInhibited)
 	{
 		// Inhibition is implemented by temporarily performing all calculations in component space rather
 		// than in world space. So, the feet will still remain locked, but this time relative to the character.
 
-		const auto& ComponentTransform{GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform()};
-
-		FootState.LockLocation = ComponentTransform.TransformPosition(FootState.LockComponentRelativeLocation);
-		FootState.LockRotation = ComponentTransform.TransformRotation(FootState.LockComponentRelativeRotation);
+		FootState.LockLocation = Context.ComponentTransform.TransformPosition(FootState.LockComponentRelativeLocation);
+		FootState.LockRotation = Context.ComponentTransform.TransformRotation(FootState.LockComponentRelativeRotation);
 
 		if (MovementBase.bHasRelativeLocation)
 		{
-			const auto BaseRotationInverse{MovementBase.Rotation.Inverse()};
-
-			FootState.LockMovementBaseRelativeLocation = BaseRotationInverse.RotateVector(FootState.LockLocation - MovementBase.Location);
-			FootState.LockMovementBaseRelativeRotation = BaseRotationInverse * FootState.LockRotation;
+			FootState.LockMovementBaseRelativeLocation = Context.MovementBaseRotationInverse.RotateVector(
+				FootState.LockLocation - MovementBase.Location);
+			FootState.LockMovementBaseRelativeRotation = Context.MovementBaseRotationInverse * FootState.LockRotation;
 		}
 	}
 	else
@@ -965,15 +1028,15 @@ void UAlsAnimationInstance::RefreshFootLock(FAlsFootState& FootState, const FNam
 			FootState.LockRotation = MovementBase.Rotation * FootState.LockMovementBaseRelativeRotation;
 		}
 
-		FootState.LockComponentRelativeLocation = ComponentTransformInverse.TransformPosition(FootState.LockLocation);
-		FootState.LockComponentRelativeRotation = ComponentTransformInverse.TransformRotation(FootState.LockRotation);
+		FootState.LockComponentRelativeLocation = Context.ComponentTransformInverse.TransformPosition(FootState.LockLocation);
+		FootState.LockComponentRelativeRotation = Context.ComponentTransformInverse.TransformRotation(FootState.LockRotation);
 	}
 
 	FinalLocation = FMath::Lerp(FinalLocation, FootState.LockLocation, FootState.LockAmount);
 	FinalRotation = FQuat::Slerp(FinalRotation, FootState.LockRotation, FootState.LockAmount);
 }
 
-void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const float DeltaTime,
+void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const FAlsFeetRefreshContext& Context,
 											  FVector& FinalLocation, FQuat& FinalRotation) const
 {
 	if (!FAnimWeight::IsRelevant(FootState.IkAmount))
@@ -985,7 +1048,7 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 		return;
 	}
 
-	if (CurrentGameplayTags.HasTag(AlsLocomotionModeTags::InAir))
+	if (Context.bInAir)
 	{
 		FootState.OffsetTargetLocationZ = 0.0f;
 		FootState.OffsetTargetRotation = FQuat::Identity;
@@ -1000,8 +1063,8 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 		{
 			static constexpr auto InterpolationSpeed{15.0f};
 
-			FootState.OffsetLocationZ = FMath::FInterpTo(FootState.OffsetLocationZ, 0.0f, DeltaTime, InterpolationSpeed);
-			FootState.OffsetRotation = FMath::QInterpTo(FootState.OffsetRotation, FQuat::Identity, DeltaTime, InterpolationSpeed);
+			FootState.OffsetLocationZ = FMath::FInterpTo(FootState.OffsetLocationZ, 0.0f, Context.DeltaTime, InterpolationSpeed);
+			FootState.OffsetRotation = FMath::QInterpTo(FootState.OffsetRotation, FQuat::Identity, Context.DeltaTime, InterpolationSpeed);
 
 			FinalLocation.Z += FootState.OffsetLocationZ;
 			FinalRotation = FootState.OffsetRotation * FinalRotation;
@@ -1013,7 +1076,7 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 	// Trace downward from the foot location to find the geometry. If the surface is walkable, save the impact location and normal.
 
 	const FVector TraceLocation{
-		FinalLocation.X, FinalLocation.Y, GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform().GetLocation().Z
+		FinalLocation.X, FinalLocation.Y, Context.ComponentTransform.GetLocation().Z
 	};
 	
 	bool bGroundValid{FootState.Hit.IsValidBlockingHit() && FootState.Hit.ImpactNormal.Z >= LocomotionState.WalkableFloorZ};
@@ -1109,13 +1172,13 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 		static constexpr auto LocationInterpolationTargetVelocityAmount{1.0f};
 
 		FootState.OffsetLocationZ = UAlsMath::SpringDampFloat(FootState.OffsetLocationZ, FootState.OffsetTargetLocationZ,
-															  FootState.OffsetSpringState, DeltaTime, LocationInterpolationFrequency,
+															  FootState.OffsetSpringState, Context.DeltaTime, LocationInterpolationFrequency,
 															  LocationInterpolationDampingRatio, LocationInterpolationTargetVelocityAmount);
 
 		static constexpr auto RotationInterpolationSpeed{30.0f};
 
 		FootState.OffsetRotation = FMath::QInterpTo(FootState.OffsetRotation, FootState.OffsetTargetRotation,
-													DeltaTime, RotationInterpolationSpeed);
+													Context.DeltaTime, RotationInterpolationSpeed);
 	}
 
 	FinalLocation.Z += FootState.OffsetLocationZ;
@@ -1173,7 +1236,7 @@ void UAlsAnimationInstance::PlayQuickStopAnimation()
 		return;
 	}
 
-	if (!CurrentGameplayTags.HasTag(AlsRotationModeTags::VelocityDirection))
+	if (!HasStateTag(EAlsStateTagBits::VelocityDirection))
 	{
 		PlayTransitionLeftAnimation(Settings->Transitions.QuickStopBlendInDuration, Settings->Transitions.QuickStopBlendOutDuration,
 									Settings->Transitions.QuickStopPlayRate.X, Settings->Transitions.QuickStopStartTime);
@@ -1207,11 +1270,18 @@ void UAlsAnimationInstance::PlayQuickStopAnimation()
 void UAlsAnimationInstance::PlayTransitionAnimation(UAnimSequenceBase* Animation, const float BlendInDuration, const float BlendOutDuration,
 													const float PlayRate, const float StartTime, const bool bFromStandingIdleOnly)
 {
-	if (bFromStandingIdleOnly && (LocomotionState.bMoving || !CurrentGameplayTags.HasTag(AlsStanceTags::Standing)))
+	if (bFromStandingIdleOnly && (LocomotionState.bMoving || !HasStateTag(EAlsStateTagBits::Standing)))
 	{
 		return;
 	}
 
+	if (IsValid(Settings) && Settings->Transitions.bPlayThroughAnimationGraph)
+	{
+		TransitionsState.SlotRequest.Play(Animation, UAlsConstants::TransitionSlotName(), BlendInDuration,
+		                                  BlendOutDuration, PlayRate, StartTime);
+		return;
+	}
+
 	// Animation montages can't be played in the worker thread, so queue them up to play later in the game thread.
 
 	TransitionsState.QueuedTransitionAnimation = Animation;
@@ -1234,7 +1304,7 @@ void UAlsAnimationInstance::PlayTransitionLeftAnimation(const float BlendInDurat
 		return;
 	}
 
-	PlayTransitionAnimation(CurrentGameplayTags.HasTag(AlsStanceTags::Crouching)
+	PlayTransitionAnimation(HasStateTag(EAlsStateTagBits::Crouching)
 								? Settings->Transitions.CrouchingTransitionLeftAnimation
 								: Settings->Transitions.StandingTransitionLeftAnimation,
 							BlendInDuration, BlendOutDuration, PlayRate, StartTime, bFromStandingIdleOnly);
@@ -1248,7 +1318,7 @@ void UAlsAnimationInstance::PlayTransitionRightAnimation(const float BlendInDura
 		return;
 	}
 
-	PlayTransitionAnimation(CurrentGameplayTags.HasTag(AlsStanceTags::Crouching)
+	PlayTransitionAnimation(HasStateTag(EAlsStateTagBits::Crouching)
 								? Settings->Transitions.CrouchingTransitionRightAnimation
 								: Settings->Transitions.StandingTransitionRightAnimation,
 							BlendInDuration, BlendOutDuration, PlayRate, StartTime, bFromStandingIdleOnly);
@@ -1259,6 +1329,9 @@ void UAlsAnimationInstance::StopTransitionAndTurnInPlaceAnimations(const float B
 	TransitionsState.bStopTransitionsQueued = true;
 	TransitionsState.QueuedStopTransitionsBlendOutDuration = BlendOutDuration;
 
+	TransitionsState.SlotRequest.Stop(BlendOutDuration);
+	TurnInPlaceState.SlotRequest.Stop(BlendOutDuration);
+
 	if (IsInGameThread())
 	{
 		StopQueuedTransitionAndTurnInPlaceAnimations();
@@ -1282,7 +1355,7 @@ void UAlsAnimationInstance::RefreshDynamicTransition()
 		return;
 	}
 
-	if (!TransitionsState.bTransitionsAllowed || LocomotionState.bMoving || !CurrentGameplayTags.HasTag(AlsLocomotionModeTags::Grounded))
+	if (!TransitionsState.bTransitionsAllowed || LocomotionState.bMoving || !HasStateTag(EAlsStateTagBits::Grounded))
 	{
 		return;
 	}
@@ -1317,25 +1390,25 @@ void UAlsAnimationInstance::RefreshDynamicTransition()
 
 	if (!bTransitionLeftAllowed)
 	{
-		DynamicTransitionAnimation = CurrentGameplayTags.HasTag(AlsStanceTags::Crouching)
+		DynamicTransitionAnimation = HasStateTag(EAlsStateTagBits::Crouching)
 										 ? Settings->Transitions.CrouchingDynamicTransitionRightAnimation
 										 : Settings->Transitions.StandingDynamicTransitionRightAnimation;
 	}
 	else if (!bTransitionRightAllowed)
 	{
-		DynamicTransitionAnimation = CurrentGameplayTags.HasTag(AlsStanceTags::Crouching)
+		DynamicTransitionAnimation = HasStateTag(EAlsStateTagBits::Crouching)
 										 ? Settings->Transitions.CrouchingDynamicTransitionLeftAnimation
 										 : Settings->Transitions.StandingDynamicTransitionLeftAnimation;
 	}
 	else if (FootLockLeftDistanceSquared >= FootLockRightDistanceSquared)
 	{
-		DynamicTransitionAnimation = CurrentGameplayTags.HasTag(AlsStanceTags::Crouching)
+		DynamicTransitionAnimation = HasStateTag(EAlsStateTagBits::Crouching)
 										 ? Settings->Transitions.CrouchingDynamicTransitionLeftAnimation
 										 : Settings->Transitions.StandingDynamicTransitionLeftAnimation;
 	}
 	else
 	{
-		DynamicTransitionAnimation = CurrentGameplayTags.HasTag(AlsStanceTags::Crouching)
+		DynamicTransitionAnimation = HasStateTag(EAlsStateTagBits::Crouching)
 										 ? Settings->Transitions.CrouchingDynamicTransitionRightAnimation
 										 : Settings->Transitions.StandingDynamicTransitionRightAnimation;
 	}
@@ -1346,6 +1419,15 @@ void UAlsAnimationInstance::RefreshDynamicTransition()
 
 		TransitionsState.DynamicTransitionsFrameDelay = 2;
 
+		if (Settings->Transitions.bPlayThroughAnimationGraph)
+		{
+			TransitionsState.SlotRequest.Play(DynamicTransitionAnimation, UAlsConstants::TransitionSlotName(),
+			                                  Settings->Transitions.DynamicTransitionBlendDuration,
+			                                  Settings->Transitions.DynamicTransitionBlendDuration,
+			                                  Settings->Transitions.DynamicTransitionPlayRate, 0.0f);
+			return;
+		}
+
 		// Animation montages can't be played in the worker thread, so queue them up to play later in the game thread.
 
 		TransitionsState.QueuedTransitionAnimation = DynamicTransitionAnimation;
@@ -1400,7 +1482,7 @@ void UAlsAnimationInstance::StopQueuedTransitionAndTurnInPlaceAnimations()
 
 bool UAlsAnimationInstance::IsRotateInPlaceAllowed()
 {
-	return CurrentGameplayTags.HasTag(AlsRotationModeTags::Aiming) || CurrentGameplayTags.HasTag(AlsViewModeTags::FirstPerson);
+	return HasStateTag(EAlsStateTagBits::Aiming) || HasStateTag(EAlsStateTagBits::FirstPerson);
 }
 
 void UAlsAnimationInstance::RefreshRotateInPlace(const float DeltaTime)
@@ -1409,7 +1491,7 @@ void UAlsAnimationInstance::RefreshRotateInPlace(const float DeltaTime)
 
 	// Rotate in place is allowed only if the character is standing still and aiming or in first-person view mode.
 
-	if (LocomotionState.bMoving || !CurrentGameplayTags.HasTag(AlsLocomotionModeTags::Grounded) || !IsRotateInPlaceAllowed())
+	if (LocomotionState.bMoving || !HasStateTag(EAlsStateTagBits::Grounded) || !IsRotateInPlaceAllowed())
 	{
 		RotateInPlaceState.bRotatingLeft = false;
 		RotateInPlaceState.bRotatingRight = false;
@@ -1462,7 +1544,7 @@ void UAlsAnimationInstance::RefreshRotateInPlace(const float DeltaTime)
 
 bool UAlsAnimationInstance::IsTurnInPlaceAllowed()
 {
-	return CurrentGameplayTags.HasTag(AlsRotationModeTags::ViewDirection) && !CurrentGameplayTags.HasTag(AlsViewModeTags::FirstPerson);
+	return HasStateTag(EAlsStateTagBits::ViewDirection) && !HasStateTag(EAlsStateTagBits::FirstPerson);
 }
 
 void UAlsAnimationInstance::RefreshTurnInPlace(const float DeltaTime)
@@ -1470,7 +1552,7 @@ void UAlsAnimationInstance::RefreshTurnInPlace(const float DeltaTime)
 	// Turn in place is allowed only if transitions are allowed, the character
 	// standing still and looking at the camera and not in first-person mode.
 
-	if (LocomotionState.bMoving || !CurrentGameplayTags.HasTag(AlsLocomotionModeTags::Grounded) || !IsTurnInPlaceAllowed())
+	if (LocomotionState.bMoving || !HasStateTag(EAlsStateTagBits::Grounded) || !IsTurnInPlaceAllowed())
 	{
 		TurnInPlaceState.ActivationDelay = 0.0f;
 		TurnInPlaceState.bFootLockInhibited = false;
@@ -1517,7 +1599,7 @@ void UAlsAnimationInstance::RefreshTurnInPlace(const float DeltaTime)
 	UAlsTurnInPlaceSettings* TurnInPlaceSettings{nullptr};
 	FName TurnInPlaceSlotName;
 
-	if (CurrentGameplayTags.HasTag(AlsStanceTags::Standing))
+	if (HasStateTag(EAlsStateTagBits::Standing))
 	{
 		TurnInPlaceSlotName = UAlsConstants::TurnInPlaceStandingSlotName();
 
@@ -1530,7 +1612,7 @@ void UAlsAnimationInstance::RefreshTurnInPlace(const float DeltaTime)
 			TurnInPlaceSettings = ViewYawAngle < 0.0f ? Settings->TurnInPlace.StandingTurn180Left : Settings->TurnInPlace.StandingTurn180Right;
 		}
 	}
-	else if (CurrentGameplayTags.HasTag(AlsStanceTags::Crouching))
+	else if (HasStateTag(EAlsStateTagBits::Crouching))
 	{
 		TurnInPlaceSlotName = UAlsConstants::TurnInPlaceCrouchingSlotName();
 
@@ -1546,6 +1628,17 @@ void UAlsAnimationInstance::RefreshTurnInPlace(const float DeltaTime)
 
 	if (TurnInPlaceSettings && IsValid(TurnInPlaceSettings) && ALS_ENSURE(IsValid(TurnInPlaceSettings->Animation)))
 	{
+		if (Settings->TurnInPlace.bPlayThroughAnimationGraph)
+		{
+			// The animation graph picks up the request in this same update, so there is nothing to queue.
+
+			TurnInPlaceState.SlotRequest.Play(TurnInPlaceSettings->Animation, TurnInPlaceSlotName, Settings->TurnInPlace.BlendDuration,
+			                                  Settings->TurnInPlace.BlendDuration, TurnInPlaceSettings->PlayRate, 0.0f);
+
+			ApplyTurnInPlaceSettings(*TurnInPlaceSettings, ViewYawAngle);
+			return;
+		}
+
 		// Animation montages can't be played in the worker thread, so queue them up to play later in the game thread.
 
 		TurnInPlaceState.QueuedSettings = TurnInPlaceSettings;
@@ -1574,20 +1667,44 @@ void UAlsAnimationInstance::PlayQueuedTurnInPlaceAnimation()
 									  Settings->TurnInPlace.BlendDuration, Settings->TurnInPlace.BlendDuration,
 									  TurnInPlaceSettings->PlayRate, 1, 0.0f);
 
-	// Scale the rotation yaw delta (gets scaled in animation graph) to compensate for play rate and turn angle (if allowed).
-
-	TurnInPlaceState.PlayRate = TurnInPlaceSettings->bScalePlayRateByAnimatedTurnAngle
-									? TurnInPlaceSettings->PlayRate *
-									  FMath::Abs(TurnInPlaceState.QueuedTurnYawAngle / TurnInPlaceSettings->AnimatedTurnAngle)
-									: TurnInPlaceSettings->PlayRate;
-
-	TurnInPlaceState.bFootLockInhibited = Settings->TurnInPlace.bDisableFootLock;
+	ApplyTurnInPlaceSettings(*TurnInPlaceSettings, TurnInPlaceState.QueuedTurnYawAngle);
 
 	TurnInPlaceState.QueuedSettings = nullptr;
 	TurnInPlaceState.QueuedSlotName = NAME_None;
 	TurnInPlaceState.QueuedTurnYawAngle = 0.0f;
 }
 
+void UAlsAnimationInstance::ApplyTurnInPlaceSettings(const UAlsTurnInPlaceSettings& TurnInPlaceSettings, const float TurnYawAngle)
+{
+	// Scale the rotation yaw delta (gets scaled in animation graph) to compensate for play rate and turn angle (if allowed).
+
+	if (TurnInPlaceSettings.bScalePlayRateByAnimatedTurnAngle)
+	{
+		// Prefer the turn angle baked into the animation metadata over the manually entered one.
+
+		const auto* Metadata{
+			IsValid(TurnInPlaceSettings.Animation)
+				? TurnInPlaceSettings.Animation->FindMetaDataByClass<UAlsAnimationMetadata>()
+				: nullptr
+		};
+
+		auto AnimatedTurnAngle{TurnInPlaceSettings.AnimatedTurnAngle};
+
+		if (IsValid(Metadata) && Metadata->HasRootYaw() && FMath::Abs(Metadata->GetTotalYawAngle()) > UE_KINDA_SMALL_NUMBER)
+		{
+			AnimatedTurnAngle = Metadata->GetTotalYawAngle();
+		}
+
+		TurnInPlaceState.PlayRate = TurnInPlaceSettings.PlayRate * FMath::Abs(TurnYawAngle / AnimatedTurnAngle);
+	}
+	else
+	{
+		TurnInPlaceState.PlayRate = TurnInPlaceSettings.PlayRate;
+	}
+
+	TurnInPlaceState.bFootLockInhibited = Settings->TurnInPlace.bDisableFootLock;
+}
+
 float UAlsAnimationInstance::GetCurveValueClamped01(const FName& CurveName) const
 {
 	return UAlsMath::Clamp01(GetCurveValue(CurveName));
@@ -5,10 +5,12 @@
 #include "AlsPhysicalAnimationComponent.h"
 #include "AlsAbilitySystemComponent.h"
 #include "AlsMotionWarpingComponent.h"
+#include "AlsCharacterComponent.h"
 #include "TimerManager.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Curves/CurveFloat.h"
+#include "Engine/AssetManager.h"
 #include "GameFramework/GameNetworkManager.h"
 #include "GameFramework/PlayerController.h"
 #include "Net/UnrealNetwork.h"
@@ -227,6 +229,12 @@ void AAlsCharacter::PostInitializeComponents()
 
 	AnimationInstance = Cast<UAlsAnimationInstance>(GetMesh()->GetAnimInstance());
 
+	const auto* DefaultCharacter{GetDefault<AAlsCharacter>(GetClass())};
+
+	DefaultEyeHeight = DefaultCharacter->BaseEyeHeight;
+	DefaultCapsuleHalfHeight = DefaultCharacter->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
+	DefaultCapsuleRadius = DefaultCharacter->GetCapsuleComponent()->GetUnscaledCapsuleRadius();
+
 	// workaround for crash since 5.6
 	//PhysicalAnimation->SetSkeletalMeshComponent(GetMesh());
 
@@ -255,6 +263,23 @@ void AAlsCharacter::BeginPlay()
 	// workaround for crash since 5.6
 	PhysicalAnimation->SetSkeletalMeshComponent(GetMesh());
 
+	// Stream in the assets of the granted abilities and the initial assets of the character
+	// components, such as the starting overlay, so that they don't have to be loaded synchronously on first use.
+
+	TArray<FSoftObjectPath> Assets;
+
+	if (IsValid(AbilitySet))
+	{
+		AbilitySet->GetPreloadAssets(Assets);
+	}
+
+	ForEachComponent<UAlsCharacterComponent>(false, [&Assets](const UAlsCharacterComponent* Component)
+	{
+		Component->GetPreloadAssets(Assets);
+	});
+
+	PreloadAssets(MoveTemp(Assets));
+
 	Super::BeginPlay();
 
 	if (GetLocalRole() >= ROLE_AutonomousProxy)
@@ -289,6 +314,70 @@ void AAlsCharacter::BeginPlay()
 	RefreshGait();
 }
 
+TSharedPtr<FStreamableHandle> AAlsCharacter::PreloadAssets(TArray<FSoftObjectPath>&& Assets, FStreamableDelegate&& OnLoaded)
+{
+	if (Assets.IsEmpty())
+	{
+		OnLoaded.ExecuteIfBound();
+		return nullptr;
+	}
+
+	auto Handle{UAssetManager::GetStreamableManager().RequestAsyncLoad(Assets, MoveTemp(OnLoaded))};
+	if (Handle.IsValid())
+	{
+		for (const auto& Asset : Assets)
+		{
+			AssetPreloadHandles.Add(Asset, Handle);
+		}
+	}
+
+	return Handle;
+}
+
+bool AAlsCharacter::IsAssetPreloadComplete() const
+{
+	for (const auto& [Asset, Handle] : AssetPreloadHandles)
+	{
+		if (Handle.IsValid() && Handle->IsLoadingInProgress())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void AAlsCharacter::SubscribeMontageToStateChanged(UAnimInstance& MontageAnimationInstance, const int32 MontageInstanceID,
+                                                   FAlsCharacter_OnStateChanged::FDelegate&& Delegate)
+{
+	UnsubscribeMontageFromStateChanged(MontageInstanceID);
+
+	// Montage instances can be terminated without their subscriptions being removed, so remove them here. Each montage
+	// instance is looked up in the animation instance it plays on, since that may belong to any mesh of the character.
+
+	for (auto Iterator{MontageStateChangedSubscriptions.CreateIterator()}; Iterator; ++Iterator)
+	{
+		auto* AnimationInstance{Iterator.Value().AnimationInstance.Get()};
+
+		if (!IsValid(AnimationInstance) || AnimationInstance->GetMontageInstanceForID(Iterator.Key()) == nullptr)
+		{
+			OnStateChanged.Remove(Iterator.Value().Handle);
+			Iterator.RemoveCurrent();
+		}
+	}
+
+	MontageStateChangedSubscriptions.Add(MontageInstanceID, {&MontageAnimationInstance, OnStateChanged.Add(MoveTemp(Delegate))});
+}
+
+void AAlsCharacter::UnsubscribeMontageFromStateChanged(const int32 MontageInstanceID)
+{
+	FMontageStateChangedSubscription Subscription;
+	if (MontageStateChangedSubscriptions.RemoveAndCopyValue(MontageInstanceID, Subscription))
+	{
+		OnStateChanged.Remove(Subscription.Handle);
+	}
+}
+
 void AAlsCharacter::NotifyControllerChanged()
 {
 	OnContollerChanged.Broadcast(PreviousController, Controller);
@@ -303,6 +392,15 @@ void AAlsCharacter::SetupPlayerInputComponent(UInputComponent* Input)
 	OnSetupPlayerInputComponent.Broadcast(Input);
 }
 
+void AAlsCharacter::PostNetReceive()
+{
+	Super::PostNetReceive();
+
+	// Desired state tags are replicated without rep notifies, so assume that they may have changed.
+
+	MarkGameplayTagsChanged();
+}
+
 void AAlsCharacter::PostNetReceiveLocationAndRotation()
 {
 	// AActor::PostNetReceiveLocationAndRotation() function is only called on simulated proxies, so there is no need to check roles here.
@@ -398,19 +496,31 @@ void AAlsCharacter::Tick(const float DeltaTime)
 
 	RefreshLocomotionEarly();
 
-	RefreshView(DeltaTime);
+	auto ViewAndRotationDeltaTime{DeltaTime};
+	const auto bRefreshViewAndRotation{TryConsumeCrowdModeDeltaTime(ViewAndRotationDeltaTime)};
+
+	if (bRefreshViewAndRotation)
+	{
+		RefreshView(ViewAndRotationDeltaTime);
+	}
+
 	RefreshRotationMode();
 	RefreshLocomotion(DeltaTime);
 	RefreshGait();
 
-	RefreshGroundedRotation(DeltaTime);
-	RefreshInAirRotation(DeltaTime);
+	if (bRefreshViewAndRotation)
+	{
+		RefreshGroundedRotation(ViewAndRotationDeltaTime);
+		RefreshInAirRotation(ViewAndRotationDeltaTime);
+	}
 
 	OnRefresh.Broadcast(DeltaTime);
 
 	Super::Tick(DeltaTime);
 
 	RefreshLocomotionLate(DeltaTime);
+
+	RefreshLocomotionHistory();
 }
 
 void AAlsCharacter::PossessedBy(AController* NewController)
@@ -549,6 +659,8 @@ void AAlsCharacter::SetOverlayMode(const FGameplayTag& NewOverlayMode, const boo
 
 	OverlayMode = NewOverlayMode;
 
+	MarkGameplayTagsChanged();
+
 	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, OverlayMode, this)
 
 	OnOverlayModeChanged.Broadcast(PreviousOverlayMode);
@@ -601,6 +713,8 @@ void AAlsCharacter::SetViewMode(const FGameplayTag& NewViewMode)
 
 	ViewMode = NewViewMode;
 
+	MarkGameplayTagsChanged();
+
 	OnViewModeChanged(PreviousViewMode);
 }
 
@@ -637,7 +751,11 @@ void AAlsCharacter::SetLocomotionMode(const FGameplayTag& NewLocomotionMode)
 
 	LocomotionMode = NewLocomotionMode;
 
+	MarkGameplayTagsChanged();
+
 	NotifyLocomotionModeChanged(PreviousLocomotionMode);
+
+	OnStateChanged.Broadcast();
 }
 
 void AAlsCharacter::NotifyLocomotionModeChanged(const FGameplayTag& PreviousLocomotionMode)
@@ -684,6 +802,8 @@ void AAlsCharacter::SetDesiredRotationMode(const FGameplayTag& NewDesiredRotatio
 
 	DesiredRotationMode = NewDesiredRotationMode;
 
+	MarkGameplayTagsChanged();
+
 	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, DesiredRotationMode, this)
 }
 
@@ -700,7 +820,11 @@ void AAlsCharacter::SetRotationMode(const FGameplayTag& NewRotationMode)
 
 	RotationMode = NewRotationMode;
 
+	MarkGameplayTagsChanged();
+
 	OnRotationModeChanged(PreviousRotationMode);
+
+	OnStateChanged.Broadcast();
 }
 
 void AAlsCharacter::OnRotationModeChanged_Implementation(const FGameplayTag& PreviousRotationMode) {}
@@ -803,6 +927,8 @@ void AAlsCharacter::SetDesiredStance(const FGameplayTag& NewDesiredStance)
 
 	DesiredStance = NewDesiredStance;
 
+	MarkGameplayTagsChanged();
+
 	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, DesiredStance, this)
 
 	ApplyDesiredStance();
@@ -916,7 +1042,11 @@ void AAlsCharacter::SetStance(const FGameplayTag& NewStance)
 
 	Stance = NewStance;
 
+	MarkGameplayTagsChanged();
+
 	OnStanceChanged(PreviousStance);
+
+	OnStateChanged.Broadcast();
 }
 
 void AAlsCharacter::OnStanceChanged_Implementation(const FGameplayTag& PreviousStance) {}
@@ -930,6 +1060,8 @@ void AAlsCharacter::SetDesiredGait(const FGameplayTag& NewDesiredGait)
 
 	DesiredGait = NewDesiredGait;
 
+	MarkGameplayTagsChanged();
+
 	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, DesiredGait, this)
 
 	if (GetLocalRole() == ROLE_AutonomousProxy)
@@ -954,6 +1086,8 @@ void AAlsCharacter::SetGait(const FGameplayTag& NewGait)
 
 	Gait = NewGait;
 
+	MarkGameplayTagsChanged();
+
 	OnGaitChanged(PreviousGait);
 }
 
@@ -1054,15 +1188,34 @@ void AAlsCharacter::RefreshInput(const float DeltaTime)
 {
 	if (GetLocalRole() >= ROLE_AutonomousProxy)
 	{
-		SetInputDirection(GetCharacterMovement()->GetCurrentAcceleration() / GetCharacterMovement()->GetMaxAcceleration());
+		if (bCrowdMode && !AlsCharacterMovement->NavMovementProperties.bUseAccelerationForPaths)
+		{
+			// In crowd mode, path following requests the velocity directly, so there is no acceleration to take the input from.
+
+			FVector RequestedVelocity;
+			SetInputDirection(AlsCharacterMovement->TryGetRequestedVelocity(RequestedVelocity)
+				                  ? RequestedVelocity.GetSafeNormal2D()
+				                  : FVector::ZeroVector);
+		}
+		else
+		{
+			SetInputDirection(GetCharacterMovement()->GetCurrentAcceleration() / GetCharacterMovement()->GetMaxAcceleration());
+		}
 	}
 
+	const auto bHadInput{LocomotionState.bHasInput};
+
 	LocomotionState.bHasInput = InputDirection.SizeSquared() > UE_KINDA_SMALL_NUMBER;
 
 	if (LocomotionState.bHasInput)
 	{
 		LocomotionState.InputYawAngle = UE_REAL_TO_FLOAT(UAlsMath::DirectionToAngleXY(InputDirection));
 	}
+
+	if (LocomotionState.bHasInput != bHadInput)
+	{
+		OnStateChanged.Broadcast();
+	}
 }
 
 void AAlsCharacter::SetReplicatedViewRotation(const FRotator& NewViewRotation, const bool bSendRpc)
@@ -1184,6 +1337,59 @@ void AAlsCharacter::TryAdjustControllRotation(float DeltaTime)
 	}
 }
 
+void AAlsCharacter::SetCrowdModeEnabled(const bool bEnabled)
+{
+	if (bCrowdMode == bEnabled)
+	{
+		return;
+	}
+
+	bCrowdMode = bEnabled;
+	CrowdModeDeltaTime = 0.0f;
+
+	// Without acceleration for paths, path following calls RequestDirectMove() instead of adding movement input. Without
+	// acceleration for requested moves, the movement component then sets the velocity to the requested one right away
+	// and doesn't brake while a move is requested, instead of accelerating towards it.
+
+	if (bCrowdMode)
+	{
+		bPreviousUseAccelerationForPaths = AlsCharacterMovement->NavMovementProperties.bUseAccelerationForPaths;
+		bPreviousRequestedMoveUseAcceleration = AlsCharacterMovement->bRequestedMoveUseAcceleration;
+
+		AlsCharacterMovement->NavMovementProperties.bUseAccelerationForPaths = false;
+		AlsCharacterMovement->bRequestedMoveUseAcceleration = false;
+	}
+	else
+	{
+		AlsCharacterMovement->NavMovementProperties.bUseAccelerationForPaths = bPreviousUseAccelerationForPaths;
+		AlsCharacterMovement->bRequestedMoveUseAcceleration = bPreviousRequestedMoveUseAcceleration;
+	}
+}
+
+bool AAlsCharacter::TryConsumeCrowdModeDeltaTime(float& DeltaTime)
+{
+	// The view and rotation are kept relative to a rotating movement base by offsetting them every frame, so they
+	// can't be refreshed at a reduced rate while standing on one.
+
+	if (!bCrowdMode || MovementBase.bHasRelativeRotation)
+	{
+		DeltaTime += CrowdModeDeltaTime;
+		CrowdModeDeltaTime = 0.0f;
+		return true;
+	}
+
+	CrowdModeDeltaTime += DeltaTime;
+
+	if (CrowdModeDeltaTime < Settings->CrowdModeUpdateInterval)
+	{
+		return false;
+	}
+
+	DeltaTime = CrowdModeDeltaTime;
+	CrowdModeDeltaTime = 0.0f;
+	return true;
+}
+
 void AAlsCharacter::RefreshView(const float DeltaTime)
 {
 	if (MovementBase.bHasRelativeRotation)
@@ -1437,6 +1643,45 @@ void AAlsCharacter::RefreshLocomotionLate(const float DeltaTime)
 	}
 }
 
+bool AAlsCharacter::SampleLocomotionHistory(const double Time, FAlsLocomotionHistorySample& Sample) const
+{
+	return LocomotionHistory.Sample(Time, Sample);
+}
+
+void AAlsCharacter::RefreshLocomotionHistory()
+{
+	if (LocomotionHistory.GetCapacity() != Settings->LocomotionHistoryCapacity)
+	{
+		LocomotionHistory.Initialize(Settings->LocomotionHistoryCapacity);
+	}
+
+	if (LocomotionHistory.GetCapacity() <= 0)
+	{
+		return;
+	}
+
+	const auto Time{GetWorld()->GetTimeSeconds()};
+
+	if (LocomotionHistory.Num() > 0 && Time - LocomotionHistoryRecordTime < Settings->LocomotionHistoryInterval)
+	{
+		return;
+	}
+
+	LocomotionHistoryRecordTime = Time;
+
+	FAlsLocomotionHistorySample Sample;
+	Sample.Time = Time;
+	Sample.Location = GetActorLocation();
+	Sample.Rotation = GetActorRotation();
+	Sample.ViewRotation = ViewState.Rotation;
+	Sample.CapsuleHalfHeight = GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	Sample.LocomotionMode = LocomotionMode;
+	Sample.Stance = Stance;
+	Sample.Gait = Gait;
+
+	LocomotionHistory.Record(Sample);
+}
+
 void AAlsCharacter::Jump()
 {
 	if (Stance == AlsStanceTags::Standing && !GetLocomotionAction().IsValid() && LocomotionMode == AlsLocomotionModeTags::Grounded)
@@ -1951,33 +2196,37 @@ void AAlsCharacter::OnEndLie(const float HalfHeightAdjust, const float ScaledHal
 void AAlsCharacter::RefreshCapsuleSize(float DeltaTime)
 {
 	// Update capsule height and radius
-	auto DefaultCharacter = GetDefault<AAlsCharacter>(GetClass());
-	auto InitialEyeHeight = DefaultCharacter->BaseEyeHeight;
-	auto InitialHalfHeight = DefaultCharacter->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
-	auto InitialRadius = DefaultCharacter->GetCapsuleComponent()->GetUnscaledCapsuleRadius();
-	auto CrouchedHalfHeight = AlsCharacterMovement->GetCrouchedHalfHeight();
-	auto EyeHeightSpeed = CapsuleUpdateSpeed > 0 ? FMath::Abs(InitialEyeHeight - CrouchedEyeHeight) / CapsuleUpdateSpeed : .0f;
-	auto HalfHeightSpeed = CapsuleUpdateSpeed > 0 ? FMath::Abs(InitialHalfHeight - CrouchedHalfHeight) / CapsuleUpdateSpeed : .0f;
-	if (bIsLied)
-	{
-		UpdateCapsule(DeltaTime, CrouchedEyeHeight, EyeHeightSpeed, CrouchedHalfHeight, HalfHeightSpeed, InitialRadius, 0.0f);
-	}
-	else if (bIsCrouched)
-	{
-		UpdateCapsule(DeltaTime, CrouchedEyeHeight, EyeHeightSpeed, CrouchedHalfHeight, HalfHeightSpeed, InitialRadius, 0.0f);
-	}
-	else
+	const auto CrouchedHalfHeight{AlsCharacterMovement->GetCrouchedHalfHeight()};
+	const auto bShrunk{bIsLied || bIsCrouched};
+	const auto TargetEyeHeight{bShrunk ? CrouchedEyeHeight : DefaultEyeHeight};
+
+	// Height is not allowed to be smaller than radius.
+	const auto TargetHalfHeight{FMath::Max(bShrunk ? CrouchedHalfHeight : DefaultCapsuleHalfHeight, DefaultCapsuleRadius)};
+
+	// Nothing to do while the capsule stays at the settled size.
+
+	if (bCapsuleSettled && SettledCapsuleHalfHeight == TargetHalfHeight && BaseEyeHeight == TargetEyeHeight &&
+	    GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight() == TargetHalfHeight)
 	{
-		UpdateCapsule(DeltaTime, InitialEyeHeight, EyeHeightSpeed, InitialHalfHeight, HalfHeightSpeed, InitialRadius, 0.0f);
+		return;
 	}
+
+	const auto EyeHeightSpeed{CapsuleUpdateSpeed > 0 ? FMath::Abs(DefaultEyeHeight - CrouchedEyeHeight) / CapsuleUpdateSpeed : .0f};
+	const auto HalfHeightSpeed{CapsuleUpdateSpeed > 0 ? FMath::Abs(DefaultCapsuleHalfHeight - CrouchedHalfHeight) / CapsuleUpdateSpeed : .0f};
+
+	bCapsuleSettled = UpdateCapsule(DeltaTime, TargetEyeHeight, EyeHeightSpeed, TargetHalfHeight, HalfHeightSpeed, DefaultCapsuleRadius, 0.0f);
+
+	SettledCapsuleHalfHeight = TargetHalfHeight;
 }
 
-void AAlsCharacter::UpdateCapsule(float DeltaTime, float EyeHeight, float EyeHeightSpeed, float HalfHeight, float HalfHeightSpeed, float Radius, float RadiusSpeed)
+bool AAlsCharacter::UpdateCapsule(float DeltaTime, float EyeHeight, float EyeHeightSpeed, float HalfHeight, float HalfHeightSpeed, float Radius, float RadiusSpeed)
 {
 	BaseEyeHeight = FMath::FInterpConstantTo(BaseEyeHeight, EyeHeight, DeltaTime, EyeHeightSpeed);
 	BaseTranslationOffset.Z = FMath::FInterpConstantTo(BaseTranslationOffset.Z, -HalfHeight, DeltaTime, HalfHeightSpeed);
 
-	AlsCharacterMovement->UpdateCapsuleSize(DeltaTime, HalfHeight, HalfHeightSpeed, Radius, RadiusSpeed);
+	const auto bCapsuleSizeReached{AlsCharacterMovement->UpdateCapsuleSize(DeltaTime, HalfHeight, HalfHeightSpeed, Radius, RadiusSpeed)};
+
+	return bCapsuleSizeReached && BaseEyeHeight == EyeHeight && BaseTranslationOffset.Z == -HalfHeight;
 }
 
 void AAlsCharacter::SetIsLied(bool bNewIsLied)
@@ -44,7 +44,23 @@ void UAlsCharacterComponent::OnRegister()
 	else
 	{
 		Character->OnContollerChanged.AddUObject(this, &ThisClass::OnControllerChanged);
-		Character->OnRefresh.AddUObject(this, &ThisClass::OnRefresh);
+
+		// Bypass ProcessEvent() for components that don't override OnRefresh in blueprint.
+
+		bBlueprintRefreshImplemented = GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ThisClass, OnRefresh));
+		Character->OnRefresh.AddUObject(this, &ThisClass::HandleRefresh);
+	}
+}
+
+void UAlsCharacterComponent::HandleRefresh(const float DeltaTime)
+{
+	if (bBlueprintRefreshImplemented)
+	{
+		OnRefresh(DeltaTime);
+	}
+	else
+	{
+		OnRefresh_Implementation(DeltaTime);
 	}
 }
 
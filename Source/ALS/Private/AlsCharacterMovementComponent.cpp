@@ -15,6 +15,8 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCharacterMovementComponent)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Skipped Encroachment Tests"), STAT_Als_SkippedEncroachmentTests, STATGROUP_Als)
+
 void FAlsCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& Move, const ENetworkMoveType MoveType)
 {
 	Super::ClientFillNetworkMoveData(Move, MoveType);
@@ -1120,6 +1122,11 @@ void UAlsCharacterMovementComponent::UnCrouch(bool bClientSimulation)
 
 	if (!bClientSimulation)
 	{
+		if (IsStandUpEncroachmentCached(PawnLocation, OldUnscaledHalfHeight))
+		{
+			return;
+		}
+
 		// Try to stay in place and see if the larger capsule fits. We use a slightly taller capsule to avoid penetration.
 		const UWorld* MyWorld = GetWorld();
 		const float SweepInflation = UE_KINDA_SMALL_NUMBER * 10.f;
@@ -1202,6 +1209,7 @@ void UAlsCharacterMovementComponent::UnCrouch(bool bClientSimulation)
 		// If still encroached then abort.
 		if (bEncroached)
 		{
+			CacheStandUpEncroachment(PawnLocation, OldUnscaledHalfHeight);
 			return;
 		}
 
@@ -1227,6 +1235,44 @@ void UAlsCharacterMovementComponent::UnCrouch(bool bClientSimulation)
 	}
 }
 
+bool UAlsCharacterMovementComponent::IsStandUpEncroachmentCached(const FVector& PawnLocation, const float UnscaledHalfHeight)
+{
+	if (EncroachmentCacheTime < 0.0)
+	{
+		return false;
+	}
+
+	// Any movement, resize or movement base change may free up the space above the character. Geometry moving
+	// on its own can't be detected without the overlap test itself, so the cached result also expires over time.
+
+	if (GetWorld()->GetTimeSeconds() - EncroachmentCacheTime > EncroachmentCacheLifetime ||
+	    EncroachmentCacheHalfHeight != UnscaledHalfHeight ||
+	    !PawnLocation.Equals(EncroachmentCacheLocation, UE_KINDA_SMALL_NUMBER * 100.0f) ||
+	    EncroachmentCacheMovementBase.Get() != CharacterOwner->GetMovementBase())
+	{
+		EncroachmentCacheTime = -1.0;
+		return false;
+	}
+
+	SkippedEncroachmentTestCount += 1;
+	INC_DWORD_STAT(STAT_Als_SkippedEncroachmentTests)
+
+	return true;
+}
+
+void UAlsCharacterMovementComponent::CacheStandUpEncroachment(const FVector& PawnLocation, const float UnscaledHalfHeight)
+{
+	if (EncroachmentCacheLifetime <= 0.0f)
+	{
+		return;
+	}
+
+	EncroachmentCacheLocation = PawnLocation;
+	EncroachmentCacheHalfHeight = UnscaledHalfHeight;
+	EncroachmentCacheTime = GetWorld()->GetTimeSeconds();
+	EncroachmentCacheMovementBase = CharacterOwner->GetMovementBase();
+}
+
 void UAlsCharacterMovementComponent::Lie(bool bClientSimulation)
 {
 	if (!HasValidData())
@@ -1327,6 +1373,11 @@ void UAlsCharacterMovementComponent::UnLie(bool bClientSimulation)
 
 	if (!bClientSimulation)
 	{
+		if (IsStandUpEncroachmentCached(PawnLocation, OldUnscaledHalfHeight))
+		{
+			return;
+		}
+
 		// Try to stay in place and see if the larger capsule fits. We use a slightly taller capsule to avoid penetration.
 		const UWorld* MyWorld = GetWorld();
 		const float SweepInflation = UE_KINDA_SMALL_NUMBER * 10.f;
@@ -1409,6 +1460,7 @@ void UAlsCharacterMovementComponent::UnLie(bool bClientSimulation)
 		// If still encroached then abort.
 		if (bEncroached)
 		{
+			CacheStandUpEncroachment(PawnLocation, OldUnscaledHalfHeight);
 			return;
 		}
 
@@ -1439,11 +1491,11 @@ TObjectPtr<AAlsCharacter> UAlsCharacterMovementComponent::GetAlsCharacter() cons
 	return Cast<AAlsCharacter>(CharacterOwner);
 }
 
-void UAlsCharacterMovementComponent::UpdateCapsuleSize(float DeltaTime, float TargetHalfHeight, float HeightSpeed, float TargetRadius, float RadiusSpeed)
+bool UAlsCharacterMovementComponent::UpdateCapsuleSize(float DeltaTime, float TargetHalfHeight, float HeightSpeed, float TargetRadius, float RadiusSpeed)
 {
 	if (!HasValidData())
 	{
-		return;
+		return true;
 	}
 
 	check(CharacterOwner->GetCapsuleComponent());
@@ -1453,24 +1505,49 @@ void UAlsCharacterMovementComponent::UpdateCapsuleSize(float DeltaTime, float Ta
 
 	const float OldUnscaledHalfHeight = CharacterOwner->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
 	const float OldUnscaledRadius = CharacterOwner->GetCapsuleComponent()->GetUnscaledCapsuleRadius();
-	const float HalfHeight = FMath::FInterpConstantTo(OldUnscaledHalfHeight, TargetHalfHeight, DeltaTime, HeightSpeed);
-	const float Radius = FMath::FInterpConstantTo(OldUnscaledRadius, TargetRadius, DeltaTime, RadiusSpeed);
-	
-	if (OldUnscaledHalfHeight != HalfHeight || OldUnscaledRadius != Radius)
+
+	if (OldUnscaledHalfHeight == TargetHalfHeight && OldUnscaledRadius == TargetRadius)
 	{
-		// Now call SetCapsuleSize() to cause touch/untouch events and actually grow the capsule
-		CharacterOwner->GetCapsuleComponent()->SetCapsuleSize(Radius, HalfHeight, false);
+		InterpolatedCapsuleSize = AppliedCapsuleSize = {TargetHalfHeight, TargetRadius};
+		return true;
+	}
 
-		auto* Mesh{HasValidData() ? CharacterOwner->GetMesh() : nullptr};
+	// Continue from the interpolated size unless the capsule has been resized by something else since the last resize.
 
-		if (Mesh != nullptr && IsValid(Mesh))
-		{
-			Mesh->GetRelativeLocation_DirectMutable().Z = -HalfHeight;
-		}
+	if (AppliedCapsuleSize.X != OldUnscaledHalfHeight || AppliedCapsuleSize.Y != OldUnscaledRadius)
+	{
+		InterpolatedCapsuleSize = AppliedCapsuleSize = {OldUnscaledHalfHeight, OldUnscaledRadius};
+	}
 
-		// Change actor location must be applied after change mesh relative location.
-		CharacterOwner->AddActorLocalOffset(FVector{0.0, 0.0, HalfHeight - OldUnscaledHalfHeight});
+	InterpolatedCapsuleSize.X = FMath::FInterpConstantTo(InterpolatedCapsuleSize.X, TargetHalfHeight, DeltaTime, HeightSpeed);
+	InterpolatedCapsuleSize.Y = FMath::FInterpConstantTo(InterpolatedCapsuleSize.Y, TargetRadius, DeltaTime, RadiusSpeed);
+
+	const float HalfHeight = InterpolatedCapsuleSize.X;
+	const float Radius = InterpolatedCapsuleSize.Y;
+	const bool bTargetReached = HalfHeight == TargetHalfHeight && Radius == TargetRadius;
+
+	if (!bTargetReached && FMath::Abs(HalfHeight - OldUnscaledHalfHeight) < CapsuleResizeStep &&
+	    FMath::Abs(Radius - OldUnscaledRadius) < CapsuleResizeStep)
+	{
+		return false;
+	}
+
+	AppliedCapsuleSize = InterpolatedCapsuleSize;
+
+	// Now call SetCapsuleSize() to cause touch/untouch events and actually grow the capsule
+	CharacterOwner->GetCapsuleComponent()->SetCapsuleSize(Radius, HalfHeight, false);
+
+	auto* Mesh{HasValidData() ? CharacterOwner->GetMesh() : nullptr};
+
+	if (Mesh != nullptr && IsValid(Mesh))
+	{
+		Mesh->GetRelativeLocation_DirectMutable().Z = -HalfHeight;
 	}
+
+	// Change actor location must be applied after change mesh relative location.
+	CharacterOwner->AddActorLocalOffset(FVector{0.0, 0.0, HalfHeight - OldUnscaledHalfHeight});
+
+	return bTargetReached;
 }
 
 bool UAlsCharacterMovementComponent::CanAttemptJump() const
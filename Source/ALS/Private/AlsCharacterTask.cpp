@@ -15,6 +15,10 @@ void UAlsCharacterTask::OnRegister()
 		Character = Cast<AAlsCharacter>(GetOuter());
 		ALS_ENSURE(Character.IsValid());
 	}
+
+	// Calling an unimplemented blueprint event still goes through ProcessEvent(), so skip it entirely when possible.
+
+	bBlueprintRefreshImplemented = GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ThisClass, K2_OnRefresh));
 }
 
 void UAlsCharacterTask::Begin()
@@ -24,14 +28,88 @@ void UAlsCharacterTask::Begin()
 	{
 		bActive = true;
 		bEpilogRunningCurrently = false;
+		PendingRefreshDeltaTime = 0.0f;
+		LastTriggerTags.Reset();
+		LastGameplayTagsGeneration = Character->GetGameplayTagsGeneration() - 1;
+		bInitialRefreshPending = true;
+		OnActiveChanged();
 		BindInput(Character->InputComponent.Get());
 		K2_OnBegin();
 	}
 }
 
+void UAlsCharacterTask::TickRefresh(const float DeltaTime)
+{
+	if (!bActive)
+	{
+		return;
+	}
+
+	PendingRefreshDeltaTime += DeltaTime;
+
+	switch (RefreshMode)
+	{
+		case EAlsCharacterTaskRefreshMode::EveryFrame:
+			break;
+
+		case EAlsCharacterTaskRefreshMode::FixedRate:
+			if (PendingRefreshDeltaTime < RefreshInterval)
+			{
+				return;
+			}
+			break;
+
+		case EAlsCharacterTaskRefreshMode::OnTagChange:
+			// The trigger tags are always checked, so that they are up to date for the next change.
+			if (!HaveTriggerTagsChanged() && !bInitialRefreshPending)
+			{
+				return;
+			}
+			break;
+
+		default:
+			PendingRefreshDeltaTime = 0.0f;
+			return;
+	}
+
+	const auto RefreshDeltaTime{PendingRefreshDeltaTime};
+	PendingRefreshDeltaTime = 0.0f;
+	bInitialRefreshPending = false;
+
+	Refresh(RefreshDeltaTime);
+}
+
+bool UAlsCharacterTask::HaveTriggerTagsChanged()
+{
+	const auto GameplayTagsGeneration{Character->GetGameplayTagsGeneration()};
+	if (LastGameplayTagsGeneration == GameplayTagsGeneration)
+	{
+		return false;
+	}
+
+	LastGameplayTagsGeneration = GameplayTagsGeneration;
+
+	if (RefreshTriggerTags.IsEmpty())
+	{
+		return true;
+	}
+
+	FGameplayTagContainer OwnedTags;
+	Character->GetOwnedGameplayTags(OwnedTags);
+
+	auto TriggerTags{OwnedTags.Filter(RefreshTriggerTags)};
+	if (TriggerTags == LastTriggerTags)
+	{
+		return false;
+	}
+
+	LastTriggerTags = MoveTemp(TriggerTags);
+	return true;
+}
+
 void UAlsCharacterTask::Refresh(float DeltaTime)
 {
-	if (bActive)
+	if (bActive && bBlueprintRefreshImplemented)
 	{
 		K2_OnRefresh(DeltaTime);
 	}
@@ -51,6 +129,8 @@ void UAlsCharacterTask::OnFinished()
 	K2_OnFinished();
 }
 
+void UAlsCharacterTask::OnActiveChanged() {}
+
 void UAlsCharacterTask::End()
 {
 	if (bActive)
@@ -58,6 +138,7 @@ void UAlsCharacterTask::End()
 		OnEnd(false);
 		bEpilogRunningCurrently = IsEpilogRunning();
 		bActive = false;
+		OnActiveChanged();
 		if (!bEpilogRunningCurrently)
 		{
 			OnFinished();
@@ -81,6 +162,7 @@ void UAlsCharacterTask::Cancel()
 		bActive = false;
 		bEpilogRunningCurrently = IsEpilogRunning();
 		bActive = false;
+		OnActiveChanged();
 		if (!bEpilogRunningCurrently)
 		{
 			OnFinished();
@@ -4,6 +4,62 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsMotionWarpingComponent)
 
+bool FAlsReplicatedWarpTarget::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	bSuccess = true;
+
+	Archive << Name;
+
+	uint8 bFromComponentByte{bFromComponent};
+	Archive.SerializeBits(&bFromComponentByte, 1);
+	bFromComponent = bFromComponentByte > 0;
+
+	if (bFromComponent)
+	{
+		// Location and rotation are calculated from the component on the receiving side.
+
+		UObject* ComponentObject{const_cast<USceneComponent*>(Component.Get())};
+		bSuccess &= Map->SerializeObject(Archive, USceneComponent::StaticClass(), ComponentObject);
+
+		Archive << BoneName;
+
+		uint8 bFollowComponentByte{bFollowComponent};
+		Archive.SerializeBits(&bFollowComponentByte, 1);
+
+		if (Archive.IsLoading())
+		{
+			Component = Cast<USceneComponent>(ComponentObject);
+			bFollowComponent = bFollowComponentByte > 0;
+		}
+
+		return true;
+	}
+
+	bool bLocationSuccess;
+	Location.NetSerialize(Archive, Map, bLocationSuccess);
+	bSuccess &= bLocationSuccess;
+
+	uint8 bYawOnly{FMath::IsNearlyZero(Rotation.Pitch) && FMath::IsNearlyZero(Rotation.Roll)};
+	Archive.SerializeBits(&bYawOnly, 1);
+
+	if (bYawOnly > 0)
+	{
+		auto CompressedYaw{FRotator::CompressAxisToShort(Rotation.Yaw)};
+		Archive << CompressedYaw;
+
+		if (Archive.IsLoading())
+		{
+			Rotation = {0.0f, FRotator::DecompressAxisFromShort(CompressedYaw), 0.0f};
+		}
+	}
+	else
+	{
+		Rotation.SerializeCompressedShort(Archive);
+	}
+
+	return true;
+}
+
 void UAlsMotionWarpingComponent::AddOrUpdateReplicatedWarpTargetFromLocationAndRotation(FName WarpTargetName, FVector TargetLocation, FRotator TargetRotation)
 {
 	auto* Character{Cast<AAlsCharacter>(GetOwner())};
@@ -13,7 +69,7 @@ void UAlsMotionWarpingComponent::AddOrUpdateReplicatedWarpTargetFromLocationAndR
 
 	if (Character->HasServerRole())
 	{
-		MulticastAddOrUpdateWarpTargetFromLocationAndRotation(WarpTargetName, TargetLocation, TargetRotation);
+		ReplicateWarpTargetFromLocationAndRotation(WarpTargetName, TargetLocation, TargetRotation);
 	}
 }
 
@@ -35,17 +91,7 @@ void UAlsMotionWarpingComponent::ServerAddOrUpdateWarpTargetFromLocationAndRotat
 {
 	AddOrUpdateWarpTargetFromLocationAndRotation(WarpTargetName, TargetLocation, TargetRotation);
 
-	MulticastAddOrUpdateWarpTargetFromLocationAndRotation(WarpTargetName, TargetLocation, TargetRotation);
-}
-
-void UAlsMotionWarpingComponent::MulticastAddOrUpdateWarpTargetFromLocationAndRotation_Implementation(FName WarpTargetName, FVector_NetQuantize TargetLocation,
-																									  FRotator TargetRotation)
-{
-	auto* Character{Cast<AAlsCharacter>(GetOwner())};
-	if (Character->GetLocalRole() == ROLE_SimulatedProxy)
-	{
-		AddOrUpdateWarpTargetFromLocationAndRotation(WarpTargetName, TargetLocation, TargetRotation);
-	}
+	ReplicateWarpTargetFromLocationAndRotation(WarpTargetName, TargetLocation, TargetRotation);
 }
 
 void UAlsMotionWarpingComponent::AddOrUpdateReplicatedWarpTargetFromComponent(FName WarpTargetName, const USceneComponent* Component, FName BoneName,
@@ -58,7 +104,7 @@ void UAlsMotionWarpingComponent::AddOrUpdateReplicatedWarpTargetFromComponent(FN
 
 	if (Character->HasServerRole())
 	{
-		MulticastAddOrUpdateWarpTargetFromComponent(WarpTargetName, Component, BoneName, bFollowComponent);
+		ReplicateWarpTargetFromComponent(WarpTargetName, Component, BoneName, bFollowComponent);
 	}
 }
 
@@ -81,15 +127,50 @@ void UAlsMotionWarpingComponent::ServerAddOrUpdateWarpTargetFromComponent_Implem
 {
 	AddOrUpdateWarpTargetFromComponent(WarpTargetName, Component, BoneName, bFollowComponent, EWarpTargetLocationOffsetDirection::TargetsForwardVector);
 
-	MulticastAddOrUpdateWarpTargetFromComponent(WarpTargetName, Component, BoneName, bFollowComponent);
+	ReplicateWarpTargetFromComponent(WarpTargetName, Component, BoneName, bFollowComponent);
 }
 
-void UAlsMotionWarpingComponent::MulticastAddOrUpdateWarpTargetFromComponent_Implementation(FName WarpTargetName, const USceneComponent* Component, FName BoneName,
-																							bool bFollowComponent)
+void UAlsMotionWarpingComponent::ReplicateWarpTargetFromLocationAndRotation(const FName& WarpTargetName, const FVector& TargetLocation,
+                                                                            const FRotator& TargetRotation)
 {
-	auto* Character{Cast<AAlsCharacter>(GetOwner())};
-	if (Character->GetLocalRole() == ROLE_SimulatedProxy)
+	FAlsReplicatedWarpTarget WarpTarget;
+	WarpTarget.Name = WarpTargetName;
+	WarpTarget.Location = TargetLocation;
+	WarpTarget.Rotation = TargetRotation;
+
+	MulticastAddOrUpdateWarpTarget(WarpTarget);
+}
+
+void UAlsMotionWarpingComponent::ReplicateWarpTargetFromComponent(const FName& WarpTargetName, const USceneComponent* Component,
+                                                                  const FName& BoneName, const bool bFollowComponent)
+{
+	FAlsReplicatedWarpTarget WarpTarget;
+	WarpTarget.Name = WarpTargetName;
+	WarpTarget.Component = Component;
+	WarpTarget.BoneName = BoneName;
+	WarpTarget.bFromComponent = true;
+	WarpTarget.bFollowComponent = bFollowComponent;
+
+	MulticastAddOrUpdateWarpTarget(WarpTarget);
+}
+
+void UAlsMotionWarpingComponent::MulticastAddOrUpdateWarpTarget_Implementation(const FAlsReplicatedWarpTarget& WarpTarget)
+{
+	// The local and autonomous roles apply warp targets themselves, only simulated proxies need them replicated.
+
+	const auto* Character{Cast<AAlsCharacter>(GetOwner())};
+	if (!IsValid(Character) || Character->GetLocalRole() != ROLE_SimulatedProxy)
+	{
+		return;
+	}
+
+	if (!WarpTarget.bFromComponent)
+	{
+		AddOrUpdateWarpTargetFromLocationAndRotation(WarpTarget.Name, WarpTarget.Location, WarpTarget.Rotation);
+	}
+	else if (WarpTarget.Component.IsValid())
 	{
-		AddOrUpdateWarpTargetFromComponent(WarpTargetName, Component, BoneName, bFollowComponent, EWarpTargetLocationOffsetDirection::TargetsForwardVector);
+		AddOrUpdateWarpTargetFromComponent(WarpTarget.Name, WarpTarget.Component.Get(), WarpTarget.BoneName, WarpTarget.bFollowComponent,
+		                                   EWarpTargetLocationOffsetDirection::TargetsForwardVector);
 	}
 }
@@ -798,6 +798,7 @@ void FAlsRagdollingState::Start(UAlsRagdollingSettings* NewSettings)
 	RagdollingAnimInstance->UnFreeze();
 
 	RagdollingAnimInstance->SetStartBlendTime(Settings->StartBlendTime);
+	RagdollingAnimInstance->SetSnapshotBones(Settings->SnapshotBones);
 
 	PullForce = 0.0f;
 	ElapsedTime = 0.0f;
@@ -10,21 +10,22 @@
 bool UAlsLocalMontageTask::Play(const FAlsPlayMontageParameter& Parameter)
 {
 	auto* AnimInstance{Character->GetMesh()->GetAnimInstance()};
-	if (AnimInstance->Montage_Play(Parameter.MontageToPlay, Parameter.PlayRate, EMontagePlayReturnType::MontageLength, Parameter.StartTime, false))
+	auto* Montage{Parameter.LoadMontage()};
+	if (AnimInstance->Montage_Play(Montage, Parameter.PlayRate, EMontagePlayReturnType::MontageLength, Parameter.StartTime, false))
 	{
-		CurrentMontage = Parameter.MontageToPlay;
+		CurrentMontage = Montage;
 
 		// Start at a given Section.
 		if (Parameter.SectionName != NAME_None)
 		{
-			AnimInstance->Montage_JumpToSection(Parameter.SectionName, Parameter.MontageToPlay);
+			AnimInstance->Montage_JumpToSection(Parameter.SectionName, Montage);
 		}
 
 		FOnMontageEnded EndDelegate;
 		EndDelegate.BindUObject(this, &ThisClass::OnEndMontage);
-		AnimInstance->Montage_SetEndDelegate(EndDelegate, Parameter.MontageToPlay);
+		AnimInstance->Montage_SetEndDelegate(EndDelegate, Montage);
 
-		if (auto* MontageInstance = AnimInstance->GetActiveInstanceForMontage(Parameter.MontageToPlay))
+		if (auto* MontageInstance = AnimInstance->GetActiveInstanceForMontage(Montage))
 		{
 			// AnimInstance's OnPlayMontageNotifyBegin/End fire for all notify. Then stores Montage's InstanceID
 			MontageInstanceID = MontageInstance->GetInstanceID();
@@ -17,15 +17,13 @@ void UAlsOverlayTask::Begin()
 			Character->GetMesh()->LinkAnimClassLayers(OverlayAnimClass);
 			OverlayAnimInstance = Cast<UAlsOverlayAnimInstance>(Character->GetMesh()->GetLinkedAnimLayerInstanceByClass(OverlayAnimClass));
 		}
-
-		OverlayAnimInstance->Refresh(this);
 	}
 	Super::Begin();
 }
 
-void UAlsOverlayTask::Refresh(float DeltaTime)
+void UAlsOverlayTask::OnActiveChanged()
 {
-	Super::Refresh(DeltaTime);
+	Super::OnActiveChanged();
 	if (OverlayAnimInstance.IsValid())
 	{
 		OverlayAnimInstance->Refresh(this);
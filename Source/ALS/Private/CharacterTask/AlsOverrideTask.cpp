@@ -17,15 +17,13 @@ void UAlsOverrideTask::Begin()
 			Character->GetMesh()->LinkAnimClassLayers(OverrideAnimClass);
 			OverrideAnimInstance = Cast<UAlsCharacterTaskAnimInstance>(Character->GetMesh()->GetLinkedAnimLayerInstanceByClass(OverrideAnimClass));
 		}
-
-		OverrideAnimInstance->Refresh(this);
 	}
 	Super::Begin();
 }
 
-void UAlsOverrideTask::Refresh(float DeltaTime)
+void UAlsOverrideTask::OnActiveChanged()
 {
-	Super::Refresh(DeltaTime);
+	Super::OnActiveChanged();
 	if (OverrideAnimInstance.IsValid())
 	{
 		OverrideAnimInstance->Refresh(this);
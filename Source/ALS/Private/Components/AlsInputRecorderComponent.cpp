@@ -0,0 +1,464 @@
+#include "Components/AlsInputRecorderComponent.h"
+
+#include "AlsAbilitySystemComponent.h"
+#include "AlsCharacter.h"
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Utility/AlsLog.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsInputRecorderComponent)
+
+namespace AlsInputRecorderComponent
+{
+	// The engine time step is global, so it is only saved when the first replay starts and restored when the last one stops.
+	int32 ActiveReplaysCount{0};
+	bool bPreviousUseFixedTimeStep{false};
+	double PreviousFixedDeltaTime{0.0};
+
+	bool SaveRecording(FAlsInputRecording& Recording, const FString& FilePath)
+	{
+		TArray<uint8> Data;
+
+		FMemoryWriter Writer{Data};
+		FObjectAndNameAsStringProxyArchive Archive{Writer, false};
+
+		FAlsInputRecording::StaticStruct()->SerializeItem(Archive, &Recording, nullptr);
+
+		return !Writer.IsError() && FFileHelper::SaveArrayToFile(Data, *FilePath);
+	}
+
+	bool LoadRecording(FAlsInputRecording& Recording, const FString& FilePath)
+	{
+		TArray<uint8> Data;
+
+		if (!FFileHelper::LoadFileToArray(Data, *FilePath))
+		{
+			return false;
+		}
+
+		FMemoryReader Reader{Data};
+		FObjectAndNameAsStringProxyArchive Archive{Reader, true};
+
+		FAlsInputRecording::StaticStruct()->SerializeItem(Archive, &Recording, nullptr);
+
+		return !Reader.IsError();
+	}
+
+	template <typename FunctionType>
+	void ForEachRecorder(const UWorld* World, FunctionType&& Function)
+	{
+		for (TActorIterator<AAlsCharacter> Iterator{World}; Iterator; ++Iterator)
+		{
+			auto* Recorder{Iterator->FindComponentByClass<UAlsInputRecorderComponent>()};
+			if (!IsValid(Recorder))
+			{
+				continue;
+			}
+
+			// Each character gets its own file, so that all characters in the world can be recorded at once.
+
+			const auto RecorderId{Recorder->GetRecorderId()};
+			if (RecorderId.IsEmpty())
+			{
+				UE_LOG(LogAls, Warning, TEXT("%hs: %s is skipped, since its input recorder component has no recorder ID."),
+				       __FUNCTION__, *Iterator->GetName());
+				continue;
+			}
+
+			Function(*Recorder, RecorderId);
+		}
+	}
+
+	void Start(const TArray<FString>& Arguments, UWorld* World)
+	{
+		ForEachRecorder(World, [](UAlsInputRecorderComponent& Recorder, const FString&)
+		{
+			Recorder.StartRecording();
+		});
+	}
+
+	void Stop(const TArray<FString>& Arguments, UWorld* World)
+	{
+		const auto RecordingName{Arguments.Num() > 0 ? Arguments[0] : FString{TEXT("Default")}};
+
+		ForEachRecorder(World, [&RecordingName](UAlsInputRecorderComponent& Recorder, const FString& Suffix)
+		{
+			if (Recorder.IsRecording())
+			{
+				Recorder.StopRecording(RecordingName + TEXT("_") + Suffix);
+			}
+			else if (Recorder.IsReplaying())
+			{
+				Recorder.StopReplay();
+			}
+		});
+	}
+
+	void Replay(const TArray<FString>& Arguments, UWorld* World)
+	{
+		const auto RecordingName{Arguments.Num() > 0 ? Arguments[0] : FString{TEXT("Default")}};
+
+		ForEachRecorder(World, [&RecordingName](UAlsInputRecorderComponent& Recorder, const FString& Suffix)
+		{
+			Recorder.StartReplay(RecordingName + TEXT("_") + Suffix);
+		});
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs StartCommand{
+		TEXT("Als.InputRecording.Start"),
+		TEXT("Starts recording the input of all characters with an input recorder component."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Start)
+	};
+
+	FAutoConsoleCommandWithWorldAndArgs StopCommand{
+		TEXT("Als.InputRecording.Stop"),
+		TEXT("Stops recording or replaying the input of all characters with an input recorder component. ")
+		TEXT("Arguments: [RecordingName=Default]."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Stop)
+	};
+
+	FAutoConsoleCommandWithWorldAndArgs ReplayCommand{
+		TEXT("Als.InputRecording.Replay"),
+		TEXT("Replays the recorded input of all characters with an input recorder component. Arguments: [RecordingName=Default]."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Replay)
+	};
+}
+
+UAlsInputRecorderComponent::UAlsInputRecorderComponent(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PrePhysics;
+}
+
+void UAlsInputRecorderComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bRecording)
+	{
+		bRecording = false;
+		Recording.Frames.Reset();
+	}
+
+	if (IsReplaying())
+	{
+		StopReplay();
+	}
+
+	StopTicking();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UAlsInputRecorderComponent::TickComponent(const float DeltaTime, const ELevelTick TickType,
+                                               FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!Character.IsValid())
+	{
+		return;
+	}
+
+	if (bRecording)
+	{
+		RecordFrame(DeltaTime);
+	}
+	else if (IsReplaying())
+	{
+		ReplayFrame(DeltaTime);
+	}
+}
+
+FString UAlsInputRecorderComponent::GetRecordingFilePath(const FString& RecordingName)
+{
+	return FPaths::ProjectSavedDir() / TEXT("Als") / TEXT("InputRecordings") / RecordingName + TEXT(".alsinput");
+}
+
+FString UAlsInputRecorderComponent::GetRecorderId() const
+{
+	if (!RecorderId.IsNone())
+	{
+		return RecorderId.ToString();
+	}
+
+	const auto* PlayerController{Character.IsValid() ? Cast<APlayerController>(Character->GetController()) : nullptr};
+	if (!IsValid(PlayerController))
+	{
+		return FString{};
+	}
+
+	auto PlayerIndex{0};
+
+	for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		if (Iterator->Get() == PlayerController)
+		{
+			return FString::Printf(TEXT("Player%d"), PlayerIndex);
+		}
+
+		PlayerIndex += 1;
+	}
+
+	return FString{};
+}
+
+void UAlsInputRecorderComponent::StartRecording()
+{
+	if (!Character.IsValid() || bRecording || IsReplaying())
+	{
+		return;
+	}
+
+	bRecording = true;
+
+	Recording.StartLocation = Character->GetActorLocation();
+	Recording.StartRotation = Character->GetActorRotation();
+	Recording.Frames.Reset();
+
+	PendingAbilityInputTags.Reset();
+
+	auto* AbilitySystem{Character->GetAlsAbilitySystem()};
+	if (IsValid(AbilitySystem))
+	{
+		InputActivationHandle = AbilitySystem->OnInputActivation.AddUObject(this, &ThisClass::OnInputActivation);
+	}
+
+	StartTicking();
+}
+
+bool UAlsInputRecorderComponent::StopRecording(const FString& RecordingName)
+{
+	if (!bRecording)
+	{
+		return false;
+	}
+
+	bRecording = false;
+
+	auto* AbilitySystem{Character.IsValid() ? Character->GetAlsAbilitySystem() : nullptr};
+	if (IsValid(AbilitySystem))
+	{
+		AbilitySystem->OnInputActivation.Remove(InputActivationHandle);
+	}
+
+	InputActivationHandle.Reset();
+
+	StopTicking();
+
+	const auto FilePath{GetRecordingFilePath(RecordingName)};
+	const auto bSaved{AlsInputRecorderComponent::SaveRecording(Recording, FilePath)};
+
+	if (bSaved)
+	{
+		UE_LOG(LogAls, Log, TEXT("%hs: Saved %d frames to %s."), __FUNCTION__, Recording.Frames.Num(), *FilePath);
+	}
+	else
+	{
+		UE_LOG(LogAls, Error, TEXT("%hs: Failed to save the recording to %s."), __FUNCTION__, *FilePath);
+	}
+
+	Recording.Frames.Reset();
+
+	return bSaved;
+}
+
+bool UAlsInputRecorderComponent::StartReplay(const FString& RecordingName)
+{
+	if (!Character.IsValid() || bRecording || IsReplaying())
+	{
+		return false;
+	}
+
+	const auto FilePath{GetRecordingFilePath(RecordingName)};
+
+	if (!AlsInputRecorderComponent::LoadRecording(Recording, FilePath))
+	{
+		UE_LOG(LogAls, Error, TEXT("%hs: Failed to load the recording from %s."), __FUNCTION__, *FilePath);
+		return false;
+	}
+
+	Character->TeleportTo(Recording.StartLocation, Recording.StartRotation, false, true);
+
+	ReplayFrameIndex = 0;
+	ReplayStartTime = FPlatformTime::Seconds();
+	ReplayDeltaTimeMismatchesCount = 0;
+
+	if (AlsInputRecorderComponent::ActiveReplaysCount <= 0)
+	{
+		AlsInputRecorderComponent::bPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+		AlsInputRecorderComponent::PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+	}
+
+	AlsInputRecorderComponent::ActiveReplaysCount += 1;
+
+	FApp::SetUseFixedTimeStep(true);
+	SetReplayDeltaTime(0);
+
+#if STATS
+	if (bCaptureStatsWhileReplaying && IsValid(GEngine))
+	{
+		bCapturingStats = GEngine->Exec(GetWorld(), TEXT("stat StartFile"));
+	}
+#endif
+
+	UE_LOG(LogAls, Log, TEXT("%hs: Replaying %d frames from %s."), __FUNCTION__, Recording.Frames.Num(), *FilePath);
+
+	StartTicking();
+
+	return true;
+}
+
+void UAlsInputRecorderComponent::StopReplay()
+{
+	if (!IsReplaying())
+	{
+		return;
+	}
+
+	const auto ElapsedTime{FPlatformTime::Seconds() - ReplayStartTime};
+	const auto FramesCount{ReplayFrameIndex};
+
+	ReplayFrameIndex = INDEX_NONE;
+	Recording.Frames.Reset();
+
+	StopTicking();
+
+	AlsInputRecorderComponent::ActiveReplaysCount -= 1;
+
+	if (AlsInputRecorderComponent::ActiveReplaysCount <= 0)
+	{
+		FApp::SetUseFixedTimeStep(AlsInputRecorderComponent::bPreviousUseFixedTimeStep);
+		FApp::SetFixedDeltaTime(AlsInputRecorderComponent::PreviousFixedDeltaTime);
+	}
+
+#if STATS
+	if (bCapturingStats && IsValid(GEngine))
+	{
+		GEngine->Exec(GetWorld(), TEXT("stat StopFile"));
+	}
+#endif
+
+	bCapturingStats = false;
+
+	UE_LOG(LogAls, Display, TEXT("%hs: Replayed %d frames in %.3f s, Average Frame Time: %.3f ms."), __FUNCTION__,
+	       FramesCount, ElapsedTime, FramesCount > 0 ? ElapsedTime * 1000.0 / FramesCount : 0.0);
+
+	if (ReplayDeltaTimeMismatchesCount > 0)
+	{
+		UE_LOG(LogAls, Warning, TEXT("%hs: %d of %d frames were replayed with a different delta time than recorded, ")
+		       TEXT("so the replay may not match the recording. Check the time dilation and the max delta time of the world."),
+		       __FUNCTION__, ReplayDeltaTimeMismatchesCount, FramesCount);
+	}
+}
+
+void UAlsInputRecorderComponent::StartTicking()
+{
+	// Tick after the controller has processed the player input, but before the movement component consumes it.
+
+	auto* Controller{Character->GetController()};
+	if (IsValid(Controller))
+	{
+		PrimaryComponentTick.AddPrerequisite(Controller, Controller->PrimaryActorTick);
+	}
+
+	auto* CharacterMovement{Character->GetCharacterMovement()};
+	if (IsValid(CharacterMovement))
+	{
+		CharacterMovement->PrimaryComponentTick.AddPrerequisite(this, PrimaryComponentTick);
+	}
+
+	SetComponentTickEnabled(true);
+}
+
+void UAlsInputRecorderComponent::StopTicking()
+{
+	SetComponentTickEnabled(false);
+
+	if (!Character.IsValid())
+	{
+		return;
+	}
+
+	auto* Controller{Character->GetController()};
+	if (IsValid(Controller))
+	{
+		PrimaryComponentTick.RemovePrerequisite(Controller, Controller->PrimaryActorTick);
+	}
+
+	auto* CharacterMovement{Character->GetCharacterMovement()};
+	if (IsValid(CharacterMovement))
+	{
+		CharacterMovement->PrimaryComponentTick.RemovePrerequisite(this, PrimaryComponentTick);
+	}
+}
+
+void UAlsInputRecorderComponent::OnInputActivation(const FGameplayTag& InputTag)
+{
+	PendingAbilityInputTags.Add(InputTag);
+}
+
+void UAlsInputRecorderComponent::RecordFrame(const float DeltaTime)
+{
+	auto& Frame{Recording.Frames.Emplace_GetRef()};
+
+	Frame.DeltaTime = DeltaTime;
+	Frame.MovementInput = Character->GetPendingMovementInputVector();
+	Frame.ControlRotation = Character->GetControlRotation();
+	Frame.AbilityInputTags = MoveTemp(PendingAbilityInputTags);
+
+	PendingAbilityInputTags.Reset();
+}
+
+void UAlsInputRecorderComponent::ReplayFrame(const float DeltaTime)
+{
+	if (!Recording.Frames.IsValidIndex(ReplayFrameIndex))
+	{
+		StopReplay();
+		return;
+	}
+
+	const auto& Frame{Recording.Frames[ReplayFrameIndex]};
+	ReplayFrameIndex += 1;
+
+	if (!FMath::IsNearlyEqual(DeltaTime, Frame.DeltaTime, UE_KINDA_SMALL_NUMBER))
+	{
+		ReplayDeltaTimeMismatchesCount += 1;
+	}
+
+	SetReplayDeltaTime(ReplayFrameIndex);
+
+	Character->AddMovementInput(Frame.MovementInput, 1.0f, true);
+
+	auto* Controller{Character->GetController()};
+	if (IsValid(Controller))
+	{
+		Controller->SetControlRotation(Frame.ControlRotation);
+	}
+
+	auto* AbilitySystem{Character->GetAlsAbilitySystem()};
+	if (IsValid(AbilitySystem))
+	{
+		for (const auto& InputTag : Frame.AbilityInputTags)
+		{
+			AbilitySystem->TryActivateAbilitiesBySingleTag(InputTag);
+		}
+	}
+}
+
+void UAlsInputRecorderComponent::SetReplayDeltaTime(const int32 FrameIndex) const
+{
+	if (Recording.Frames.IsValidIndex(FrameIndex))
+	{
+		FApp::SetFixedDeltaTime(Recording.Frames[FrameIndex].DeltaTime);
+	}
+}
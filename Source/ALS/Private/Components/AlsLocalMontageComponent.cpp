@@ -93,7 +93,7 @@ void UAlsLocalMontageComponent::OnRefresh_Implementation(float DeltaTime)
 
 	if (CurrentLocalMontageTask.IsValid())
 	{
-		CurrentLocalMontageTask->Refresh(DeltaTime);
+		CurrentLocalMontageTask->TickRefresh(DeltaTime);
 	}
 }
 
@@ -109,21 +109,7 @@ void UAlsLocalMontageComponent::OnControllerChanged_Implementation(AController*
 void UAlsLocalMontageComponent::AddOrUpdateReplicatedWarpTargetFromLocationAndRotation(FName WarpTargetName, FVector TargetLocation,
 																									  FRotator TargetRotation)
 {
-	ensure(Character->GetLocalRole() > ROLE_SimulatedProxy);
-
-	Character->GetMotionWarping()->AddOrUpdateWarpTargetFromLocationAndRotation(WarpTargetName, TargetLocation, TargetRotation);
+	// The motion warping component applies the warp target locally and replicates it to simulated proxies.
 
-	if (Character->HasServerRole())
-	{
-		MulticastAddOrUpdateWarpTargetFromLocationAndRotation(WarpTargetName, TargetLocation, TargetRotation);
-	}
-}
-
-void UAlsLocalMontageComponent::MulticastAddOrUpdateWarpTargetFromLocationAndRotation_Implementation(FName WarpTargetName, FVector_NetQuantize TargetLocation,
-																									 FRotator TargetRotation)
-{
-	if (Character->GetLocalRole() == ROLE_SimulatedProxy)
-	{
-		Character->GetMotionWarping()->AddOrUpdateWarpTargetFromLocationAndRotation(WarpTargetName, TargetLocation, TargetRotation);
-	}
+	Character->GetMotionWarping()->AddOrUpdateReplicatedWarpTargetFromLocationAndRotation(WarpTargetName, TargetLocation, TargetRotation);
 }
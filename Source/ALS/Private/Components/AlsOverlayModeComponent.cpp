@@ -8,6 +8,31 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsOverlayModeComponent)
 
+void UAlsOverlayModeComponent::PostLoad()
+{
+	Super::PostLoad();
+
+#if WITH_EDITORONLY_DATA
+	for (const auto& [OverlayMode, OverlayClass] : OverlayClassMap_DEPRECATED)
+	{
+		OverlayTaskClassMap.FindOrAdd(OverlayMode) = OverlayClass.Get();
+	}
+
+	OverlayClassMap_DEPRECATED.Reset();
+#endif
+}
+
+void UAlsOverlayModeComponent::GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	Super::GetPreloadAssets(OutAssets);
+
+	const auto* OverlayClass{Character.IsValid() ? OverlayTaskClassMap.Find(Character->GetOverlayMode()) : nullptr};
+	if (OverlayClass != nullptr && !OverlayClass->IsNull())
+	{
+		OutAssets.Add(OverlayClass->ToSoftObjectPath());
+	}
+}
+
 void UAlsOverlayModeComponent::OnRegister()
 {
 	Super::OnRegister();
@@ -32,6 +57,35 @@ void UAlsOverlayModeComponent::BeginPlay()
 
 void UAlsOverlayModeComponent::ChangeOverlayTask(const FGameplayTag& OverlayMode)
 {
+	const auto* OverlayClass{OverlayTaskClassMap.Find(OverlayMode)};
+
+	if (OverlayClass != nullptr && !OverlayClass->IsNull() && OverlayClass->Get() == nullptr)
+	{
+		// Keep the current overlay while the new one is streaming in.
+
+		if (Character.IsValid())
+		{
+			auto OnLoaded{
+				FStreamableDelegate::CreateWeakLambda(this, [this, OverlayMode, LoadingClass = *OverlayClass]
+				{
+					if (LoadingClass.Get() == nullptr)
+					{
+						UE_LOG(LogAls, Warning, TEXT("%hs: Failed to load overlay task class %s."),
+						       __FUNCTION__, *LoadingClass.ToString());
+					}
+					else if (Character.IsValid() && Character->GetOverlayMode() == OverlayMode)
+					{
+						ChangeOverlayTask(OverlayMode);
+					}
+				})
+			};
+
+			Character->PreloadAssets({OverlayClass->ToSoftObjectPath()}, MoveTemp(OnLoaded));
+		}
+
+		return;
+	}
+
 	if (CurrentOverlayTask.IsValid())
 	{
 		CurrentOverlayTask->End();
@@ -41,7 +95,7 @@ void UAlsOverlayModeComponent::ChangeOverlayTask(const FGameplayTag& OverlayMode
 		}
 	}
 
-	if (!CurrentOverlayTask.IsValid() && OverlayClassMap.Contains(OverlayMode))
+	if (!CurrentOverlayTask.IsValid() && OverlayClass != nullptr && !OverlayClass->IsNull())
 	{
 		if (InstancedOverlayTasks.Contains(OverlayMode))
 		{
@@ -49,7 +103,7 @@ void UAlsOverlayModeComponent::ChangeOverlayTask(const FGameplayTag& OverlayMode
 		}
 		else
 		{
-			auto* NewTask{NewObject<UAlsOverlayTask>(Character.Get(), OverlayClassMap[OverlayMode])};
+			auto* NewTask{NewObject<UAlsOverlayTask>(Character.Get(), OverlayClass->Get())};
 			NewTask->Component = this;
 			InstancedOverlayTasks.Add(OverlayMode, NewTask);
 			CurrentOverlayTask = NewTask;
@@ -64,7 +118,7 @@ void UAlsOverlayModeComponent::OnRefresh_Implementation(float DeltaTime)
 	Super::OnRefresh_Implementation(DeltaTime);
 	if (CurrentOverlayTask.IsValid())
 	{
-		CurrentOverlayTask->Refresh(DeltaTime);
+		CurrentOverlayTask->TickRefresh(DeltaTime);
 	}
 }
 
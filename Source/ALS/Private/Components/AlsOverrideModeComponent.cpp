@@ -84,7 +84,7 @@ void UAlsOverrideModeComponent::OnRefresh_Implementation(float DeltaTime)
 
 	if (CurrentOverrideTask.IsValid())
 	{
-		CurrentOverrideTask->Refresh(DeltaTime);
+		CurrentOverrideTask->TickRefresh(DeltaTime);
 	}
 }
 
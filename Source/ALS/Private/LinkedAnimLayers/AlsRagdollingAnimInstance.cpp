@@ -1,6 +1,8 @@
 #include "LinkedAnimLayers/AlsRagdollingAnimInstance.h"
 #include "Abilities/Actions/AlsGameplayAbility_Ragdolling.h"
 #include "AlsPhysicalAnimationComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsRagdollingAnimInstance)
 
@@ -20,7 +22,7 @@ void UAlsRagdollingAnimInstance::Freeze()
 		// Save a snapshot of the current ragdoll pose for use in animation graph to blend out of the ragdoll.
 		if (GetSkelMeshComponent()->GetNumComponentSpaceTransforms() > 0) // When stop PIE, SnapshotPose rises Out of range exception.
 		{
-			SnapshotPose(FinalPose);
+			CaptureFinalPose();
 		}
 	}
 }
@@ -29,10 +31,100 @@ void UAlsRagdollingAnimInstance::UnFreeze()
 {
 	check(IsInGameThread())
 
-	if (FinalPose.bIsValid)
+	// Only invalidate the snapshot and keep its arrays allocated, because the ragdoll may be frozen again soon.
+
+	FinalPose.bIsValid = false;
+}
+
+void UAlsRagdollingAnimInstance::SetSnapshotBones(const TArray<FName>& BoneNames)
+{
+	check(IsInGameThread())
+
+	SnapshotBonesMask.Reset();
+
+	const auto* SkeletalMesh{GetSkelMeshComponent()->GetSkeletalMeshAsset()};
+	if (BoneNames.IsEmpty() || !IsValid(SkeletalMesh))
 	{
-		FinalPose.Reset();
+		return;
 	}
+
+	const auto& ReferenceSkeleton{SkeletalMesh->GetRefSkeleton()};
+
+	SnapshotBonesMask.Init(false, ReferenceSkeleton.GetNum());
+
+	for (const auto& BoneName : BoneNames)
+	{
+		const auto BoneIndex{ReferenceSkeleton.FindBoneIndex(BoneName)};
+		if (BoneIndex != INDEX_NONE)
+		{
+			SnapshotBonesMask[BoneIndex] = true;
+		}
+	}
+}
+
+void UAlsRagdollingAnimInstance::CaptureFinalPose()
+{
+	// Same as USkeletalMeshComponent::SnapshotPose(), but reuses the snapshot arrays, refreshes bone names only when the
+	// skeletal mesh changes, and copies the evaluated local transforms of bones not needed for the get up blend instead
+	// of calculating them from the component space transforms.
+
+	const auto* Mesh{GetSkelMeshComponent()};
+	const auto* SkeletalMesh{Mesh->GetSkeletalMeshAsset()};
+	if (!IsValid(SkeletalMesh))
+	{
+		return;
+	}
+
+	const auto& ComponentSpaceTransforms{Mesh->GetComponentSpaceTransforms()};
+	const auto& ReferenceSkeleton{SkeletalMesh->GetRefSkeleton()};
+	const auto& ReferencePose{ReferenceSkeleton.GetRefBonePose()};
+	const auto BonesCount{ComponentSpaceTransforms.Num()};
+
+	if (FinalPose.SkeletalMeshName != SkeletalMesh->GetFName() || FinalPose.BoneNames.Num() != BonesCount)
+	{
+		FinalPose.SkeletalMeshName = SkeletalMesh->GetFName();
+		FinalPose.BoneNames.SetNum(BonesCount, EAllowShrinking::No);
+
+		for (auto i{0}; i < BonesCount; i++)
+		{
+			FinalPose.BoneNames[i] = ReferenceSkeleton.GetBoneName(i);
+		}
+	}
+
+	FinalPose.LocalTransforms.SetNumUninitialized(BonesCount, EAllowShrinking::No);
+
+	// Bones that are not required by the current LOD were not evaluated, so they are set to the reference pose.
+
+	for (auto i{0}; i < BonesCount; i++)
+	{
+		FinalPose.LocalTransforms[i] = ReferencePose.IsValidIndex(i) ? ReferencePose[i] : FTransform::Identity;
+	}
+
+	const auto& BoneSpaceTransforms{Mesh->GetBoneSpaceTransforms()};
+
+	const auto bUseSnapshotBonesMask{SnapshotBonesMask.Num() == BonesCount && BoneSpaceTransforms.Num() == BonesCount};
+
+	for (const auto BoneIndex : Mesh->RequiredBones)
+	{
+		if (BoneIndex >= BonesCount)
+		{
+			continue;
+		}
+
+		if (bUseSnapshotBonesMask && !SnapshotBonesMask[BoneIndex])
+		{
+			FinalPose.LocalTransforms[BoneIndex] = BoneSpaceTransforms[BoneIndex];
+			continue;
+		}
+
+		const auto ParentIndex{ReferenceSkeleton.GetParentIndex(BoneIndex)};
+
+		FinalPose.LocalTransforms[BoneIndex] = ParentIndex >= 0
+			                                       ? ComponentSpaceTransforms[BoneIndex].GetRelativeTransform(ComponentSpaceTransforms[ParentIndex])
+			                                       : ComponentSpaceTransforms[BoneIndex];
+	}
+
+	FinalPose.bIsValid = true;
 }
 
 void UAlsRagdollingAnimInstance::Refresh(const FAlsRagdollingState& State, bool bNewActive)
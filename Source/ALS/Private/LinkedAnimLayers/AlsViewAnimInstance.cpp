@@ -48,6 +48,12 @@ void UAlsViewAnimInstance::Refresh(const float DeltaTime)
 		PitchAmount = 0.5f - PitchAngle / 180.0f;
 	}
 
+	if (Parent->bDedicatedServerProfile)
+	{
+		// The yaw angle is still needed for turn in place, but the look and spine rotation are purely cosmetic.
+		return;
+	}
+
 	const auto ViewAmount{1.0f - Parent->GetCurveValueClamped01(UAlsConstants::ViewBlockCurveName())};
 	const auto AimingAmount{Parent->GetCurveValueClamped01(UAlsConstants::AllowAimingCurveName())};
 
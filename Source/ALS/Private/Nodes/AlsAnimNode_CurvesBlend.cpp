@@ -13,6 +13,17 @@ void FAlsAnimNode_CurvesBlend::Initialize_AnyThread(const FAnimationInitializeCo
 
 	SourcePose.Initialize(Context);
 	CurvesPose.Initialize(Context);
+
+	// The curve names can't change after initialization, so the filter is built only once here.
+
+	CurveFilter.Empty();
+
+	const auto& CurrentCurveNames{GetCurveNames()};
+	if (!CurrentCurveNames.IsEmpty())
+	{
+		CurveFilter.SetFilterMode(UE::Anim::ECurveFilterMode::AllowOnlyFiltered);
+		CurveFilter.AppendNames(CurrentCurveNames);
+	}
 }
 
 void FAlsAnimNode_CurvesBlend::CacheBones_AnyThread(const FAnimationCacheBonesContext& Context)
@@ -60,9 +71,16 @@ void FAlsAnimNode_CurvesBlend::Evaluate_AnyThread(FPoseContext& Output)
 		return;
 	}
 
-	auto CurvesPoseContext{Output};
+	// Only the curves of this pose are used.
+
+	FPoseContext CurvesPoseContext{Output};
 	CurvesPose.Evaluate(CurvesPoseContext);
 
+	if (!CurveFilter.IsEmpty())
+	{
+		CurvesPoseContext.Curve.Filter(CurveFilter);
+	}
+
 	switch (GetBlendMode())
 	{
 		case EAlsCurvesBlendMode::BlendByAmount:
@@ -113,3 +131,8 @@ EAlsCurvesBlendMode FAlsAnimNode_CurvesBlend::GetBlendMode() const
 {
 	return GET_ANIM_NODE_DATA(EAlsCurvesBlendMode, BlendMode);
 }
+
+const TArray<FName>& FAlsAnimNode_CurvesBlend::GetCurveNames() const
+{
+	return GET_ANIM_NODE_DATA(TArray<FName>, CurveNames);
+}
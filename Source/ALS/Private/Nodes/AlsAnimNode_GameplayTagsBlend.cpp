@@ -4,28 +4,44 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimNode_GameplayTagsBlend)
 
+void FAlsAnimNode_GameplayTagsBlend::Initialize_AnyThread(const FAnimationInitializeContext& Context)
+{
+	Super::Initialize_AnyThread(Context);
+
+	CachedContainerVersion = INDEX_NONE;
+	CachedActiveChildIndex = 0;
+}
+
 int32 FAlsAnimNode_GameplayTagsBlend::GetActiveChildIndex()
+{
+	if (ContainerVersion >= 0 && ContainerVersion == CachedContainerVersion)
+	{
+		return CachedActiveChildIndex;
+	}
+
+	CachedContainerVersion = ContainerVersion;
+	CachedActiveChildIndex = FindActiveChildIndex();
+
+	return CachedActiveChildIndex;
+}
+
+int32 FAlsAnimNode_GameplayTagsBlend::FindActiveChildIndex() const
 {
 	const auto& CurrentContainer{GetContainer()};
+	if (!CurrentContainer.IsValid())
+	{
+		return 0;
+	}
 
 	auto Index{1};
 
 	for (auto& TagMatch : GetTagMatches())
 	{
-		if (TagMatch.bAll)
-		{
-			if (CurrentContainer.IsValid() && CurrentContainer.HasAll(TagMatch.Tags))
-			{
-				return Index;
-			}
-		}
-		else
+		if (TagMatch.bAll ? CurrentContainer.HasAll(TagMatch.Tags) : CurrentContainer.HasAny(TagMatch.Tags))
 		{
-			if (CurrentContainer.IsValid() && CurrentContainer.HasAny(TagMatch.Tags))
-			{
-				return Index;
-			}
+			return Index;
 		}
+
 		++Index;
 	}
 
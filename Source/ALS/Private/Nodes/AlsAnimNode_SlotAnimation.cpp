@@ -0,0 +1,221 @@
+#include "Nodes/AlsAnimNode_SlotAnimation.h"
+
+#include "AnimationRuntime.h"
+#include "Animation/AnimInstanceProxy.h"
+#include "Animation/AnimSequenceBase.h"
+#include "Animation/AnimTrace.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimNode_SlotAnimation)
+
+void FAlsAnimNode_SlotAnimation::Initialize_AnyThread(const FAnimationInitializeContext& Context)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_FUNC()
+
+	Super::Initialize_AnyThread(Context);
+
+	SourcePose.Initialize(Context);
+
+	Animation = nullptr;
+	Time = 0.0f;
+	BlendWeight = 0.0f;
+	bStopping = false;
+
+	// Requests made before initialization are considered stale and are not played.
+
+	bRequestCountersInitialized = false;
+
+	MarkerTickRecord.Reset();
+	DeltaTimeRecord = {};
+}
+
+void FAlsAnimNode_SlotAnimation::CacheBones_AnyThread(const FAnimationCacheBonesContext& Context)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_FUNC()
+
+	Super::CacheBones_AnyThread(Context);
+
+	SourcePose.CacheBones(Context);
+}
+
+void FAlsAnimNode_SlotAnimation::Update_AnyThread(const FAnimationUpdateContext& Context)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_FUNC()
+
+	Super::Update_AnyThread(Context);
+
+	GetEvaluateGraphExposedInputs().Execute(Context);
+
+	RefreshRequest();
+	RefreshBlendWeight(Context.GetDeltaTime());
+
+	SourcePose.Update(Context.FractionalWeight(1.0f - BlendWeight));
+
+	if (IsValid(Animation))
+	{
+		FAnimTickRecord TickRecord{
+			Animation, false, PlayRate, false, Context.GetFinalBlendWeight() * BlendWeight, Time, MarkerTickRecord
+		};
+
+		TickRecord.DeltaTimeRecord = &DeltaTimeRecord;
+		TickRecord.GatherContextData(Context);
+
+		Context.AnimInstanceProxy->AddTickRecord(TickRecord);
+	}
+
+	TRACE_ANIM_NODE_VALUE(Context, TEXT("Animation"), Animation.Get());
+	TRACE_ANIM_NODE_VALUE(Context, TEXT("Time"), Time);
+	TRACE_ANIM_NODE_VALUE(Context, TEXT("Blend Weight"), BlendWeight);
+}
+
+void FAlsAnimNode_SlotAnimation::Evaluate_AnyThread(FPoseContext& Output)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_FUNC()
+	ANIM_MT_SCOPE_CYCLE_COUNTER_VERBOSE(SlotAnimation, !IsInGameThread());
+
+	Super::Evaluate_AnyThread(Output);
+
+	if (!IsValid(Animation) || !FAnimWeight::IsRelevant(BlendWeight))
+	{
+		SourcePose.Evaluate(Output);
+		return;
+	}
+
+	if (FAnimWeight::IsFullWeight(BlendWeight))
+	{
+		EvaluateAnimation(Output);
+		return;
+	}
+
+	FPoseContext SourcePoseContext{Output};
+	SourcePose.Evaluate(SourcePoseContext);
+
+	FPoseContext AnimationPoseContext{Output};
+	EvaluateAnimation(AnimationPoseContext);
+
+	FAnimationPoseData OutputPoseData{Output};
+
+	FAnimationRuntime::BlendTwoPosesTogether(FAnimationPoseData{AnimationPoseContext}, FAnimationPoseData{SourcePoseContext},
+	                                         BlendWeight, OutputPoseData);
+}
+
+void FAlsAnimNode_SlotAnimation::GatherDebugData(FNodeDebugData& DebugData)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(GatherDebugData)
+
+	TStringBuilder<256> DebugItemBuilder{InPlace, DebugData.GetNodeName(this), TEXTVIEW(": Slot: ")};
+
+	DebugItemBuilder << GetSlotName();
+
+	if (IsValid(Animation))
+	{
+		DebugItemBuilder << TEXTVIEW(", Animation: ") << Animation->GetName();
+		DebugItemBuilder.Appendf(TEXT(", Time: %.2f, Blend Weight: %.2f"), Time, BlendWeight);
+	}
+
+	DebugData.AddDebugItem(FString{DebugItemBuilder});
+	SourcePose.GatherDebugData(DebugData.BranchFlow(1.0f - BlendWeight));
+}
+
+void FAlsAnimNode_SlotAnimation::RefreshRequest()
+{
+	if (!bRequestCountersInitialized)
+	{
+		bRequestCountersInitialized = true;
+
+		PlayCounter = Request.PlayCounter;
+		StopCounter = Request.StopCounter;
+		return;
+	}
+
+	if (PlayCounter != Request.PlayCounter)
+	{
+		PlayCounter = Request.PlayCounter;
+
+		const auto& CurrentSlotName{GetSlotName()};
+
+		if (IsValid(Request.Animation) && (CurrentSlotName.IsNone() || CurrentSlotName == Request.SlotName))
+		{
+			// The current blend weight is kept, so restarting while the previous animation
+			// is still blending out continues the blend in from where it currently is.
+
+			Animation = Request.Animation;
+			PlayRate = Request.PlayRate;
+			BlendInDuration = Request.BlendInDuration;
+			BlendOutDuration = Request.BlendOutDuration;
+			Time = FMath::Clamp(Request.StartTime, 0.0f, Animation->GetPlayLength());
+			bStopping = false;
+
+			MarkerTickRecord.Reset();
+			DeltaTimeRecord = {};
+		}
+	}
+
+	// Stop requests are processed after play requests, so a stop made in the same frame takes
+	// precedence, which is consistent with the montage based implementation.
+
+	if (StopCounter != Request.StopCounter)
+	{
+		StopCounter = Request.StopCounter;
+
+		if (IsValid(Animation))
+		{
+			StopBlendOutDuration = Request.StopBlendOutDuration;
+			bStopping = true;
+		}
+	}
+}
+
+void FAlsAnimNode_SlotAnimation::RefreshBlendWeight(const float DeltaTime)
+{
+	if (!IsValid(Animation))
+	{
+		BlendWeight = 0.0f;
+		return;
+	}
+
+	const auto RemainingTime{
+		PlayRate > UE_SMALL_NUMBER
+			? (Animation->GetPlayLength() - Time) / PlayRate
+			: TNumericLimits<float>::Max()
+	};
+
+	if (bStopping)
+	{
+		BlendWeight = StopBlendOutDuration > UE_SMALL_NUMBER
+			              ? FMath::Max(0.0f, BlendWeight - DeltaTime / StopBlendOutDuration)
+			              : 0.0f;
+	}
+	else if (RemainingTime <= BlendOutDuration)
+	{
+		BlendWeight = BlendOutDuration > UE_SMALL_NUMBER
+			              ? FMath::Min(BlendWeight, FMath::Max(0.0f, RemainingTime) / BlendOutDuration)
+			              : 0.0f;
+	}
+	else
+	{
+		BlendWeight = BlendInDuration > UE_SMALL_NUMBER
+			              ? FMath::Min(1.0f, BlendWeight + DeltaTime / BlendInDuration)
+			              : 1.0f;
+	}
+
+	if (!FAnimWeight::IsRelevant(BlendWeight) && (bStopping || RemainingTime <= 0.0f))
+	{
+		Animation = nullptr;
+		BlendWeight = 0.0f;
+		bStopping = false;
+	}
+}
+
+void FAlsAnimNode_SlotAnimation::EvaluateAnimation(FPoseContext& Output) const
+{
+	FAnimationPoseData OutputPoseData{Output};
+
+	Animation->GetAnimationPose(OutputPoseData, {
+		                            static_cast<double>(Time), Output.AnimInstanceProxy->ShouldExtractRootMotion(), DeltaTimeRecord, false
+	                            });
+}
+
+const FName& FAlsAnimNode_SlotAnimation::GetSlotName() const
+{
+	return GET_ANIM_NODE_DATA(FName, SlotName);
+}
@@ -1,6 +1,7 @@
 #include "Nodes/AlsRigUnits.h"
 
 #include "Utility/AlsMath.h"
+#include "Utility/AlsMathBatch.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsRigUnits)
 
@@ -9,6 +10,16 @@ FAlsRigVMFunction_Clamp01Float_Execute()
 	Result = UAlsMath::Clamp01(Value);
 }
 
+FAlsRigVMFunction_Clamp01FloatArray_Execute()
+{
+	Results.SetNumUninitialized(Values.Num());
+
+	for (auto i{0}; i < Values.Num(); i++)
+	{
+		Results[i] = UAlsMath::Clamp01(Values[i]);
+	}
+}
+
 void FAlsRigVMFunction_ExponentialDecayVector::Initialize()
 {
 	bInitialized = false;
@@ -28,6 +39,25 @@ FAlsRigVMFunction_ExponentialDecayVector_Execute()
 	Current = UAlsMath::ExponentialDecay(Current, Target, ExecuteContext.GetDeltaTime(), Lambda);
 }
 
+void FAlsRigVMFunction_ExponentialDecayVectorArray::Initialize()
+{
+	bInitialized = false;
+}
+
+FAlsRigVMFunction_ExponentialDecayVectorArray_Execute()
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_RIGUNIT()
+
+	if (!bInitialized || Current.Num() != Targets.Num())
+	{
+		Current = Targets;
+
+		bInitialized = true;
+	}
+
+	AlsMathBatch::ExponentialDecay(Current, Targets, Lambda, ExecuteContext.GetDeltaTime());
+}
+
 void FAlsRigUnit_CalculatePoleVector::Initialize()
 {
 	bInitialized = false;
@@ -78,6 +108,76 @@ FAlsRigUnit_CalculatePoleVector_Execute()
 	bSuccess = true;
 }
 
+void FAlsRigUnit_CalculatePoleVectors::Initialize()
+{
+	bInitialized = false;
+}
+
+FAlsRigUnit_CalculatePoleVectors_Execute()
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_RIGUNIT()
+
+	const auto* Hierarchy{ExecuteContext.Hierarchy};
+	if (!IsValid(Hierarchy))
+	{
+		return;
+	}
+
+	const auto ChainsCount{Chains.Num()};
+
+	if (!bInitialized || CachedItems.Num() != ChainsCount * 3)
+	{
+		CachedItems.Reset();
+		CachedItems.SetNum(ChainsCount * 3);
+
+		bInitialized = true;
+	}
+
+	if (Successes.Num() != ChainsCount)
+	{
+		// Results from the previous chains are not meaningful for the new ones, so everything is reset.
+
+		Successes.Init(false, ChainsCount);
+		ItemBLocations.Init(FVector::ZeroVector, ChainsCount);
+		ItemBProjectionLocations.Init(FVector::ZeroVector, ChainsCount);
+		PoleDirections.Init(FVector::XAxisVector, ChainsCount);
+	}
+
+	for (auto i{0}; i < ChainsCount; i++)
+	{
+		const auto& Chain{Chains[i]};
+
+		auto& CachedItemA{CachedItems[i * 3]};
+		auto& CachedItemB{CachedItems[i * 3 + 1]};
+		auto& CachedItemC{CachedItems[i * 3 + 2]};
+
+		if (!CachedItemA.UpdateCache(Chain.ItemA, Hierarchy) ||
+		    !CachedItemB.UpdateCache(Chain.ItemB, Hierarchy) ||
+		    !CachedItemC.UpdateCache(Chain.ItemC, Hierarchy))
+		{
+			continue;
+		}
+
+		const auto NewItemBLocation{Hierarchy->GetGlobalTransformByIndex(CachedItemB, bInitial).GetLocation()};
+		FVector NewItemBProjectionLocation;
+		FVector NewPoleDirection;
+
+		if (!UAlsMath::TryCalculatePoleVector(Hierarchy->GetGlobalTransformByIndex(CachedItemA, bInitial).GetLocation(), NewItemBLocation,
+		                                      Hierarchy->GetGlobalTransformByIndex(CachedItemC, bInitial).GetLocation(),
+		                                      NewItemBProjectionLocation, NewPoleDirection))
+		{
+			// Reuse the last successful result if a new pole vector can't be calculated.
+			Successes[i] = false;
+			continue;
+		}
+
+		ItemBLocations[i] = NewItemBLocation;
+		ItemBProjectionLocations[i] = NewItemBProjectionLocation;
+		PoleDirections[i] = NewPoleDirection;
+		Successes[i] = true;
+	}
+}
+
 void FAlsRigUnit_HandIkRetargeting::Initialize()
 {
 	bInitialized = false;
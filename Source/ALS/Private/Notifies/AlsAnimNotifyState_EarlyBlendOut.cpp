@@ -29,33 +29,86 @@ bool UAlsAnimNotifyState_EarlyBlendOut::CanBePlaced(UAnimSequenceBase* Sequence)
 }
 #endif
 
-void UAlsAnimNotifyState_EarlyBlendOut::BranchingPointNotifyTick(FBranchingPointNotifyPayload& NotifyPayload, const float DeltaTime)
+void UAlsAnimNotifyState_EarlyBlendOut::BranchingPointNotifyBegin(FBranchingPointNotifyPayload& NotifyPayload)
 {
-	Super::BranchingPointNotifyTick(NotifyPayload, DeltaTime);
+	Super::BranchingPointNotifyBegin(NotifyPayload);
 
 	const auto* Mesh{NotifyPayload.SkelMeshComponent};
 	auto* AnimationInstance{IsValid(Mesh) ? Mesh->GetAnimInstance() : nullptr};
-	const auto* Character{IsValid(AnimationInstance) ? Cast<AAlsCharacter>(Mesh->GetOwner()) : nullptr};
+	auto* Character{IsValid(AnimationInstance) ? Cast<AAlsCharacter>(Mesh->GetOwner()) : nullptr};
 
-	if (IsValid(Character) &&
-	    ((bCheckInput && Character->GetLocomotionState().bHasInput) ||
-	     (bCheckLocomotionMode && Character->GetLocomotionMode() == LocomotionModeEquals) ||
-	     (bCheckRotationMode && Character->GetRotationMode() == RotationModeEquals) ||
-	     (bCheckStance && Character->GetStance() == StanceEquals)))
+	if (!IsValid(Character) || TryBlendOut(*Character, *AnimationInstance, NotifyPayload.MontageInstanceID))
 	{
-		auto* MontageInstance{AnimationInstance->GetMontageInstanceForID(NotifyPayload.MontageInstanceID)};
-		if (!ALS_ENSURE(MontageInstance != nullptr))
-		{
-			return;
-		}
+		return;
+	}
+
+	// Notify state objects are shared by all montage instances, so the subscription is stored by the character.
+
+	Character->SubscribeMontageToStateChanged(*AnimationInstance, NotifyPayload.MontageInstanceID,
+	                                          FAlsCharacter_OnStateChanged::FDelegate::CreateUObject(
+		                                          this, &ThisClass::OnCharacterStateChanged, TWeakObjectPtr<AAlsCharacter>{Character},
+		                                          TWeakObjectPtr<UAnimInstance>{AnimationInstance}, NotifyPayload.MontageInstanceID));
+}
+
+void UAlsAnimNotifyState_EarlyBlendOut::BranchingPointNotifyEnd(FBranchingPointNotifyPayload& NotifyPayload)
+{
+	const auto* Mesh{NotifyPayload.SkelMeshComponent};
+	auto* Character{IsValid(Mesh) ? Cast<AAlsCharacter>(Mesh->GetOwner()) : nullptr};
+
+	if (IsValid(Character))
+	{
+		Character->UnsubscribeMontageFromStateChanged(NotifyPayload.MontageInstanceID);
+	}
+
+	Super::BranchingPointNotifyEnd(NotifyPayload);
+}
+
+void UAlsAnimNotifyState_EarlyBlendOut::OnCharacterStateChanged(const TWeakObjectPtr<AAlsCharacter> CharacterWeak,
+                                                                const TWeakObjectPtr<UAnimInstance> AnimationInstanceWeak,
+                                                                const int32 MontageInstanceID)
+{
+	auto* Character{CharacterWeak.Get()};
+	if (!IsValid(Character))
+	{
+		return;
+	}
+
+	// The montage may have been stopped without the notify state end being called,
+	// in which case the subscription is no longer needed.
+
+	auto* AnimationInstance{AnimationInstanceWeak.Get()};
 
-		const auto* Montage{MontageInstance->Montage.Get()};
+	if (!IsValid(AnimationInstance) || AnimationInstance->GetMontageInstanceForID(MontageInstanceID) == nullptr ||
+	    TryBlendOut(*Character, *AnimationInstance, MontageInstanceID))
+	{
+		Character->UnsubscribeMontageFromStateChanged(MontageInstanceID);
+	}
+}
 
-		FMontageBlendSettings BlendOutSettings{Montage->BlendOut};
-		BlendOutSettings.Blend.BlendTime = BlendOutDuration;
-		BlendOutSettings.BlendMode = Montage->BlendModeOut;
-		BlendOutSettings.BlendProfile = Montage->BlendProfileOut;
+bool UAlsAnimNotifyState_EarlyBlendOut::TryBlendOut(const AAlsCharacter& Character, UAnimInstance& AnimationInstance,
+                                                    const int32 MontageInstanceID) const
+{
+	if ((!bCheckInput || !Character.GetLocomotionState().bHasInput) &&
+	    (!bCheckLocomotionMode || Character.GetLocomotionMode() != LocomotionModeEquals) &&
+	    (!bCheckRotationMode || Character.GetRotationMode() != RotationModeEquals) &&
+	    (!bCheckStance || Character.GetStance() != StanceEquals))
+	{
+		return false;
+	}
 
-		MontageInstance->Stop(BlendOutSettings);
+	auto* MontageInstance{AnimationInstance.GetMontageInstanceForID(MontageInstanceID)};
+	if (!ALS_ENSURE(MontageInstance != nullptr))
+	{
+		return true;
 	}
+
+	const auto* Montage{MontageInstance->Montage.Get()};
+
+	FMontageBlendSettings BlendOutSettings{Montage->BlendOut};
+	BlendOutSettings.Blend.BlendTime = BlendOutDuration;
+	BlendOutSettings.BlendMode = Montage->BlendModeOut;
+	BlendOutSettings.BlendProfile = Montage->BlendProfileOut;
+
+	MontageInstance->Stop(BlendOutSettings);
+	return true;
 }
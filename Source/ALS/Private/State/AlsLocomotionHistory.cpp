@@ -0,0 +1,145 @@
+#include "State/AlsLocomotionHistory.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsLocomotionHistory)
+
+namespace AlsLocomotionHistory
+{
+	// Locations and capsule half heights are stored in millimeters.
+	static constexpr auto DistanceQuantizationScale{10.0};
+}
+
+void FAlsLocomotionHistory::Initialize(const int32 Capacity)
+{
+	Entries.SetNum(FMath::Max(0, Capacity));
+
+	Head = 0;
+	Count = 0;
+}
+
+void FAlsLocomotionHistory::Reset()
+{
+	Head = 0;
+	Count = 0;
+}
+
+void FAlsLocomotionHistory::Record(const FAlsLocomotionHistorySample& Sample)
+{
+	if (Entries.IsEmpty())
+	{
+		return;
+	}
+
+	int32 Index;
+
+	if (Count < Entries.Num())
+	{
+		Index = (Head + Count) % Entries.Num();
+		Count += 1;
+	}
+	else
+	{
+		Index = Head;
+		Head = (Head + 1) % Entries.Num();
+	}
+
+	auto& Entry{Entries[Index]};
+
+	Entry.Time = Sample.Time;
+
+	Entry.Location.X = FMath::RoundToInt32(Sample.Location.X * AlsLocomotionHistory::DistanceQuantizationScale);
+	Entry.Location.Y = FMath::RoundToInt32(Sample.Location.Y * AlsLocomotionHistory::DistanceQuantizationScale);
+	Entry.Location.Z = FMath::RoundToInt32(Sample.Location.Z * AlsLocomotionHistory::DistanceQuantizationScale);
+
+	Entry.Pitch = FRotator::CompressAxisToShort(Sample.Rotation.Pitch);
+	Entry.Yaw = FRotator::CompressAxisToShort(Sample.Rotation.Yaw);
+	Entry.Roll = FRotator::CompressAxisToShort(Sample.Rotation.Roll);
+
+	Entry.ViewPitch = FRotator::CompressAxisToShort(Sample.ViewRotation.Pitch);
+	Entry.ViewYaw = FRotator::CompressAxisToShort(Sample.ViewRotation.Yaw);
+
+	Entry.CapsuleHalfHeight = static_cast<uint16>(FMath::Clamp(
+		FMath::RoundToInt32(Sample.CapsuleHalfHeight * AlsLocomotionHistory::DistanceQuantizationScale), 0, MAX_uint16));
+
+	Entry.LocomotionMode = Sample.LocomotionMode;
+	Entry.Stance = Sample.Stance;
+	Entry.Gait = Sample.Gait;
+}
+
+bool FAlsLocomotionHistory::Sample(const double Time, FAlsLocomotionHistorySample& OutSample) const
+{
+	if (Count <= 0 || Time < GetEntry(0).Time)
+	{
+		return false;
+	}
+
+	const auto& LatestEntry{GetEntry(Count - 1)};
+
+	if (Time >= LatestEntry.Time)
+	{
+		Decompress(LatestEntry, OutSample);
+		return true;
+	}
+
+	// Find the first entry that is later than the given time. It can't be the first entry, since the given time
+	// is not before the first entry, and it always exists, since the given time is before the latest entry.
+
+	auto First{1};
+	auto Last{Count - 1};
+
+	while (First < Last)
+	{
+		const auto Middle{First + (Last - First) / 2};
+
+		if (GetEntry(Middle).Time > Time)
+		{
+			Last = Middle;
+		}
+		else
+		{
+			First = Middle + 1;
+		}
+	}
+
+	const auto& PreviousEntry{GetEntry(First - 1)};
+	const auto& NextEntry{GetEntry(First)};
+
+	FAlsLocomotionHistorySample NextSample;
+
+	Decompress(PreviousEntry, OutSample);
+	Decompress(NextEntry, NextSample);
+
+	const auto Interval{NextEntry.Time - PreviousEntry.Time};
+	const auto Alpha{Interval > UE_SMALL_NUMBER ? static_cast<float>((Time - PreviousEntry.Time) / Interval) : 0.0f};
+
+	OutSample.Time = Time;
+	OutSample.Location = FMath::Lerp(OutSample.Location, NextSample.Location, Alpha);
+	OutSample.Rotation = FQuat::Slerp(OutSample.Rotation.Quaternion(), NextSample.Rotation.Quaternion(), Alpha).Rotator();
+	OutSample.ViewRotation = FQuat::Slerp(OutSample.ViewRotation.Quaternion(), NextSample.ViewRotation.Quaternion(), Alpha).Rotator();
+	OutSample.CapsuleHalfHeight = FMath::Lerp(OutSample.CapsuleHalfHeight, NextSample.CapsuleHalfHeight, Alpha);
+
+	return true;
+}
+
+void FAlsLocomotionHistory::Decompress(const FEntry& Entry, FAlsLocomotionHistorySample& OutSample)
+{
+	OutSample.Time = Entry.Time;
+
+	OutSample.Location = FVector{Entry.Location} / AlsLocomotionHistory::DistanceQuantizationScale;
+
+	OutSample.Rotation.Pitch = FRotator::DecompressAxisFromShort(Entry.Pitch);
+	OutSample.Rotation.Yaw = FRotator::DecompressAxisFromShort(Entry.Yaw);
+	OutSample.Rotation.Roll = FRotator::DecompressAxisFromShort(Entry.Roll);
+
+	OutSample.ViewRotation.Pitch = FRotator::DecompressAxisFromShort(Entry.ViewPitch);
+	OutSample.ViewRotation.Yaw = FRotator::DecompressAxisFromShort(Entry.ViewYaw);
+	OutSample.ViewRotation.Roll = 0.0;
+
+	OutSample.Rotation.Normalize();
+	OutSample.ViewRotation.Normalize();
+
+	OutSample.CapsuleHalfHeight = static_cast<float>(Entry.CapsuleHalfHeight / AlsLocomotionHistory::DistanceQuantizationScale);
+
+	OutSample.LocomotionMode = Entry.LocomotionMode;
+	OutSample.Stance = Entry.Stance;
+	OutSample.Gait = Entry.Gait;
+}
@@ -0,0 +1,66 @@
+#include "State/AlsStateTagBits.h"
+
+#include "GameplayTagContainer.h"
+#include "Utility/AlsGameplayTags.h"
+
+EAlsStateTagBits AlsStateTagBits::FromGameplayTags(const FGameplayTagContainer& Tags)
+{
+	struct FTagBit
+	{
+		const FNativeGameplayTag& Tag;
+		EAlsStateTagBits Bit;
+	};
+
+	static const FTagBit TagBits[]{
+		{AlsLocomotionModeTags::Grounded, EAlsStateTagBits::Grounded},
+		{AlsLocomotionModeTags::InAir, EAlsStateTagBits::InAir},
+
+		{AlsViewModeTags::FirstPerson, EAlsStateTagBits::FirstPerson},
+		{AlsViewModeTags::ThirdPerson, EAlsStateTagBits::ThirdPerson},
+
+		{AlsRotationModeTags::VelocityDirection, EAlsStateTagBits::VelocityDirection},
+		{AlsRotationModeTags::ViewDirection, EAlsStateTagBits::ViewDirection},
+		{AlsRotationModeTags::Aiming, EAlsStateTagBits::Aiming},
+
+		{AlsStanceTags::Standing, EAlsStateTagBits::Standing},
+		{AlsStanceTags::Crouching, EAlsStateTagBits::Crouching},
+		{AlsStanceTags::LyingFront, EAlsStateTagBits::LyingFront},
+		{AlsStanceTags::LyingBack, EAlsStateTagBits::LyingBack},
+
+		{AlsGaitTags::Walking, EAlsStateTagBits::Walking},
+		{AlsGaitTags::Running, EAlsStateTagBits::Running},
+		{AlsGaitTags::Sprinting, EAlsStateTagBits::Sprinting},
+
+		{AlsOverlayModeTags::Default, EAlsStateTagBits::OverlayDefault},
+		{AlsOverlayModeTags::Masculine, EAlsStateTagBits::OverlayMasculine},
+		{AlsOverlayModeTags::Feminine, EAlsStateTagBits::OverlayFeminine},
+		{AlsOverlayModeTags::Injured, EAlsStateTagBits::OverlayInjured},
+		{AlsOverlayModeTags::HandsTied, EAlsStateTagBits::OverlayHandsTied},
+		{AlsOverlayModeTags::M4, EAlsStateTagBits::OverlayM4},
+		{AlsOverlayModeTags::PistolOneHanded, EAlsStateTagBits::OverlayPistolOneHanded},
+		{AlsOverlayModeTags::PistolTwoHanded, EAlsStateTagBits::OverlayPistolTwoHanded},
+		{AlsOverlayModeTags::Bow, EAlsStateTagBits::OverlayBow},
+		{AlsOverlayModeTags::Torch, EAlsStateTagBits::OverlayTorch},
+		{AlsOverlayModeTags::Binoculars, EAlsStateTagBits::OverlayBinoculars},
+		{AlsOverlayModeTags::Box, EAlsStateTagBits::OverlayBox},
+		{AlsOverlayModeTags::Barrel, EAlsStateTagBits::OverlayBarrel},
+
+		{AlsStateFlagTags::LeftShoulder, EAlsStateTagBits::LeftShoulder},
+		{AlsStateFlagTags::FacingUpward, EAlsStateTagBits::FacingUpward},
+		{AlsStateFlagTags::MantleHigh, EAlsStateTagBits::MantleHigh},
+		{AlsStateFlagTags::MantleMedium, EAlsStateTagBits::MantleMedium},
+		{AlsStateFlagTags::MantleLow, EAlsStateTagBits::MantleLow},
+	};
+
+	auto Bits{EAlsStateTagBits::None};
+
+	for (const auto& TagBit : TagBits)
+	{
+		if (Tags.HasTag(TagBit.Tag))
+		{
+			Bits |= TagBit.Bit;
+		}
+	}
+
+	return Bits;
+}
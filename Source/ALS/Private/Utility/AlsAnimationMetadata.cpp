@@ -0,0 +1,42 @@
+#include "Utility/AlsAnimationMetadata.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationMetadata)
+
+float UAlsAnimationMetadata::SampleTable(const TArray<float>& Table, const float Time) const
+{
+	if (Table.IsEmpty())
+	{
+		return 0.0f;
+	}
+
+	if (SampleInterval <= UE_SMALL_NUMBER || Table.Num() == 1)
+	{
+		return Table[0];
+	}
+
+	const auto SampleIndex{FMath::Clamp(Time / SampleInterval, 0.0f, static_cast<float>(Table.Num() - 1))};
+	const auto PreviousSampleIndex{FMath::FloorToInt32(SampleIndex)};
+	const auto NextSampleIndex{FMath::Min(PreviousSampleIndex + 1, Table.Num() - 1)};
+
+	return FMath::Lerp(Table[PreviousSampleIndex], Table[NextSampleIndex], SampleIndex - static_cast<float>(PreviousSampleIndex));
+}
+
+bool UAlsAnimationMetadata::IsTimeInRanges(const TArray<FAlsAnimationTimeRange>& Ranges, const float Time)
+{
+	// Ranges are sorted and don't overlap, but there are usually only a few of them, so a linear search is fine.
+
+	for (const auto& Range : Ranges)
+	{
+		if (Time < Range.StartTime)
+		{
+			return false;
+		}
+
+		if (Time <= Range.EndTime)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,407 @@
+#include "Utility/AlsMathBatch.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Math/VectorRegister.h"
+#include "Utility/AlsLog.h"
+#include "Utility/AlsMath.h"
+
+namespace AlsMathBatch
+{
+	namespace
+	{
+		constexpr auto LaneCount{4};
+
+		FORCEINLINE VectorRegister4Float LoadLanes(const float* Data, const int32 Index, const int32 Num)
+		{
+			if (Index + LaneCount <= Num)
+			{
+				return VectorLoad(Data + Index);
+			}
+
+			alignas(16) float Lanes[LaneCount]{0.0f, 0.0f, 0.0f, 0.0f};
+			FMemory::Memcpy(Lanes, Data + Index, (Num - Index) * sizeof(float));
+
+			return VectorLoadAligned(Lanes);
+		}
+
+		FORCEINLINE void StoreLanes(const VectorRegister4Float& Value, float* Data, const int32 Index, const int32 Num)
+		{
+			if (Index + LaneCount <= Num)
+			{
+				VectorStore(Value, Data + Index);
+				return;
+			}
+
+			alignas(16) float Lanes[LaneCount];
+			VectorStoreAligned(Value, Lanes);
+
+			FMemory::Memcpy(Data + Index, Lanes, (Num - Index) * sizeof(float));
+		}
+
+		FORCEINLINE VectorRegister4Float Lerp(const VectorRegister4Float& From, const VectorRegister4Float& To,
+		                                      const VectorRegister4Float& Alpha)
+		{
+			return VectorMultiplyAdd(VectorSubtract(To, From), Alpha, From);
+		}
+
+		FORCEINLINE void LerpVector(FVector& Value, const FVector& Target, const VectorRegister4Double& Alpha)
+		{
+			const auto From{VectorLoadFloat3(&Value.X)};
+
+			VectorStoreFloat3(VectorMultiplyAdd(VectorSubtract(VectorLoadFloat3(&Target.X), From), Alpha, From), &Value.X);
+		}
+
+		FORCEINLINE VectorRegister4Float InvExpApprox(const VectorRegister4Float& X)
+		{
+			// Same polynomial as in FMath::InvExpApprox().
+
+			static const auto A{VectorSetFloat1(1.00746054f)};
+			static const auto B{VectorSetFloat1(0.45053901f)};
+			static const auto C{VectorSetFloat1(0.25724632f)};
+
+			const auto Polynomial{VectorMultiplyAdd(X, VectorMultiplyAdd(X, VectorMultiplyAdd(X, C, B), A), VectorOneFloat())};
+
+			return VectorDivide(VectorOneFloat(), Polynomial);
+		}
+
+		FORCEINLINE VectorRegister4Float ExponentialDecayAlpha(const VectorRegister4Float& Lambda, const VectorRegister4Float& DeltaTime)
+		{
+			return VectorSubtract(VectorOneFloat(), InvExpApprox(VectorMultiply(Lambda, DeltaTime)));
+		}
+
+		FORCEINLINE VectorRegister4Float DampAlpha(const VectorRegister4Float& Smoothing, const VectorRegister4Float& DeltaTime)
+		{
+			return VectorSubtract(VectorOneFloat(), VectorPow(Smoothing, DeltaTime));
+		}
+
+		FORCEINLINE VectorRegister4Float UnwindDegrees(const VectorRegister4Float& Angle)
+		{
+			return VectorNormalizeRotator(Angle);
+		}
+
+		FORCEINLINE VectorRegister4Float RemapAngleForCounterClockwiseRotation(const VectorRegister4Float& Angle)
+		{
+			static const auto Threshold{VectorSetFloat1(180.0f - UAlsMath::CounterClockwiseRotationAngleThreshold)};
+
+			return VectorSelect(VectorCompareGT(Angle, Threshold), VectorSubtract(Angle, GlobalVectorConstants::Float360), Angle);
+		}
+
+		FORCEINLINE VectorRegister4Float LerpAngle(const VectorRegister4Float& From, const VectorRegister4Float& To,
+		                                           const VectorRegister4Float& Alpha)
+		{
+			const auto Delta{RemapAngleForCounterClockwiseRotation(UnwindDegrees(VectorSubtract(To, From)))};
+
+			return UnwindDegrees(VectorMultiplyAdd(Delta, Alpha, From));
+		}
+	}
+
+	void ExponentialDecayAlpha(const TArrayView<float> Alphas, const TConstArrayView<float> Lambdas, const float DeltaTime)
+	{
+		check(Lambdas.Num() == Alphas.Num())
+
+		const auto DeltaTimeVector{VectorSetFloat1(DeltaTime)};
+
+		for (auto i{0}; i < Alphas.Num(); i += LaneCount)
+		{
+			StoreLanes(ExponentialDecayAlpha(LoadLanes(Lambdas.GetData(), i, Alphas.Num()), DeltaTimeVector),
+			           Alphas.GetData(), i, Alphas.Num());
+		}
+	}
+
+	void DampAlpha(const TArrayView<float> Alphas, const TConstArrayView<float> Smoothings, const float DeltaTime)
+	{
+		check(Smoothings.Num() == Alphas.Num())
+
+		const auto DeltaTimeVector{VectorSetFloat1(DeltaTime)};
+
+		for (auto i{0}; i < Alphas.Num(); i += LaneCount)
+		{
+			StoreLanes(DampAlpha(LoadLanes(Smoothings.GetData(), i, Alphas.Num()), DeltaTimeVector),
+			           Alphas.GetData(), i, Alphas.Num());
+		}
+	}
+
+	void ExponentialDecay(const TArrayView<float> Values, const TConstArrayView<float> Targets,
+	                      const TConstArrayView<float> Lambdas, const float DeltaTime)
+	{
+		check(Targets.Num() == Values.Num() && Lambdas.Num() == Values.Num())
+
+		const auto DeltaTimeVector{VectorSetFloat1(DeltaTime)};
+
+		for (auto i{0}; i < Values.Num(); i += LaneCount)
+		{
+			const auto Lambda{LoadLanes(Lambdas.GetData(), i, Values.Num())};
+			const auto Target{LoadLanes(Targets.GetData(), i, Values.Num())};
+
+			const auto Result{Lerp(LoadLanes(Values.GetData(), i, Values.Num()), Target, ExponentialDecayAlpha(Lambda, DeltaTimeVector))};
+
+			StoreLanes(VectorSelect(VectorCompareGT(Lambda, VectorZeroFloat()), Result, Target), Values.GetData(), i, Values.Num());
+		}
+	}
+
+	void ExponentialDecay(const TArrayView<FVector> Values, const TConstArrayView<FVector> Targets,
+	                      const TConstArrayView<float> Lambdas, const float DeltaTime)
+	{
+		check(Targets.Num() == Values.Num() && Lambdas.Num() == Values.Num())
+
+		// Vectors are stored in double precision, so the interpolation amounts are calculated four at a time
+		// using float registers, and then each vector is interpolated using its own double register.
+
+		const auto DeltaTimeVector{VectorSetFloat1(DeltaTime)};
+
+		alignas(16) float Alphas[LaneCount];
+
+		for (auto i{0}; i < Values.Num(); i += LaneCount)
+		{
+			VectorStoreAligned(ExponentialDecayAlpha(LoadLanes(Lambdas.GetData(), i, Values.Num()), DeltaTimeVector), Alphas);
+
+			const auto LaneNum{FMath::Min(LaneCount, Values.Num() - i)};
+
+			for (auto j{0}; j < LaneNum; j++)
+			{
+				if (Lambdas[i + j] > 0.0f)
+				{
+					const double Alpha{Alphas[j]};
+					LerpVector(Values[i + j], Targets[i + j], MakeVectorRegisterDouble(Alpha, Alpha, Alpha, Alpha));
+				}
+				else
+				{
+					Values[i + j] = Targets[i + j];
+				}
+			}
+		}
+	}
+
+	void ExponentialDecay(const TArrayView<FVector> Values, const TConstArrayView<FVector> Targets,
+	                      const float Lambda, const float DeltaTime)
+	{
+		check(Targets.Num() == Values.Num())
+
+		if (Lambda <= 0.0f)
+		{
+			for (auto i{0}; i < Values.Num(); i++)
+			{
+				Values[i] = Targets[i];
+			}
+
+			return;
+		}
+
+		// The interpolation amount is the same for all vectors, so it's calculated only once.
+
+		const double Alpha{UAlsMath::ExponentialDecay(DeltaTime, Lambda)};
+		const auto AlphaVector{MakeVectorRegisterDouble(Alpha, Alpha, Alpha, Alpha)};
+
+		for (auto i{0}; i < Values.Num(); i++)
+		{
+			LerpVector(Values[i], Targets[i], AlphaVector);
+		}
+	}
+
+	void Damp(const TArrayView<float> Values, const TConstArrayView<float> Targets,
+	          const TConstArrayView<float> Smoothings, const float DeltaTime)
+	{
+		check(Targets.Num() == Values.Num() && Smoothings.Num() == Values.Num())
+
+		const auto DeltaTimeVector{VectorSetFloat1(DeltaTime)};
+
+		for (auto i{0}; i < Values.Num(); i += LaneCount)
+		{
+			const auto Smoothing{LoadLanes(Smoothings.GetData(), i, Values.Num())};
+			const auto Target{LoadLanes(Targets.GetData(), i, Values.Num())};
+
+			const auto Result{Lerp(LoadLanes(Values.GetData(), i, Values.Num()), Target, DampAlpha(Smoothing, DeltaTimeVector))};
+
+			StoreLanes(VectorSelect(VectorCompareGT(Smoothing, VectorZeroFloat()), Result, Target), Values.GetData(), i, Values.Num());
+		}
+	}
+
+	void LerpAngle(const TArrayView<float> Angles, const TConstArrayView<float> From,
+	               const TConstArrayView<float> To, const TConstArrayView<float> Alphas)
+	{
+		check(From.Num() == Angles.Num() && To.Num() == Angles.Num() && Alphas.Num() == Angles.Num())
+
+		for (auto i{0}; i < Angles.Num(); i += LaneCount)
+		{
+			StoreLanes(LerpAngle(LoadLanes(From.GetData(), i, Angles.Num()), LoadLanes(To.GetData(), i, Angles.Num()),
+			                     LoadLanes(Alphas.GetData(), i, Angles.Num())),
+			           Angles.GetData(), i, Angles.Num());
+		}
+	}
+
+	void ExponentialDecayAngle(const TArrayView<float> Angles, const TConstArrayView<float> Targets,
+	                           const TConstArrayView<float> Lambdas, const float DeltaTime)
+	{
+		check(Targets.Num() == Angles.Num() && Lambdas.Num() == Angles.Num())
+
+		const auto DeltaTimeVector{VectorSetFloat1(DeltaTime)};
+
+		for (auto i{0}; i < Angles.Num(); i += LaneCount)
+		{
+			const auto Lambda{LoadLanes(Lambdas.GetData(), i, Angles.Num())};
+			const auto Target{LoadLanes(Targets.GetData(), i, Angles.Num())};
+
+			const auto Result{
+				LerpAngle(LoadLanes(Angles.GetData(), i, Angles.Num()), Target, ExponentialDecayAlpha(Lambda, DeltaTimeVector))
+			};
+
+			StoreLanes(VectorSelect(VectorCompareGT(Lambda, VectorZeroFloat()), Result, Target), Angles.GetData(), i, Angles.Num());
+		}
+	}
+
+	void InterpolateAngleConstant(const TArrayView<float> Angles, const TConstArrayView<float> Targets,
+	                              const TConstArrayView<float> InterpolationSpeeds, const float DeltaTime)
+	{
+		check(Targets.Num() == Angles.Num() && InterpolationSpeeds.Num() == Angles.Num())
+
+		const auto DeltaTimeVector{VectorSetFloat1(DeltaTime)};
+
+		for (auto i{0}; i < Angles.Num(); i += LaneCount)
+		{
+			const auto Current{LoadLanes(Angles.GetData(), i, Angles.Num())};
+			const auto Target{LoadLanes(Targets.GetData(), i, Angles.Num())};
+			const auto InterpolationSpeed{LoadLanes(InterpolationSpeeds.GetData(), i, Angles.Num())};
+
+			const auto Delta{RemapAngleForCounterClockwiseRotation(UnwindDegrees(VectorSubtract(Target, Current)))};
+			const auto Alpha{VectorMultiply(InterpolationSpeed, DeltaTimeVector)};
+
+			const auto Result{UnwindDegrees(VectorAdd(Current, VectorMax(VectorNegate(Alpha), VectorMin(Delta, Alpha))))};
+
+			const auto TargetMask{
+				VectorBitwiseOr(VectorCompareLE(InterpolationSpeed, VectorZeroFloat()), VectorCompareEQ(Current, Target))
+			};
+
+			StoreLanes(VectorSelect(TargetMask, Target, Result), Angles.GetData(), i, Angles.Num());
+		}
+	}
+
+	void SpringDamp(const TArrayView<float> Values, const TConstArrayView<float> Targets, const TArrayView<FAlsSpringFloatState> SpringStates,
+	                const float DeltaTime, const float Frequency, const float DampingRatio, const float TargetVelocityAmount)
+	{
+		check(Targets.Num() == Values.Num() && SpringStates.Num() == Values.Num())
+
+		for (auto i{0}; i < Values.Num(); i++)
+		{
+			Values[i] = UAlsMath::SpringDamp(Values[i], Targets[i], SpringStates[i], DeltaTime, Frequency, DampingRatio, TargetVelocityAmount);
+		}
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+
+namespace AlsMathBatchBenchmark
+{
+	template <typename FunctionType>
+	double MeasureSeconds(const int32 IterationsCount, FunctionType&& Function)
+	{
+		const auto StartTime{FPlatformTime::Seconds()};
+
+		for (auto i{0}; i < IterationsCount; i++)
+		{
+			Function();
+		}
+
+		return FPlatformTime::Seconds() - StartTime;
+	}
+
+	void Run(const TArray<FString>& Arguments)
+	{
+		const auto ValuesCount{Arguments.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Arguments[0])) : 1024};
+		const auto IterationsCount{Arguments.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Arguments[1])) : 1000};
+
+		static constexpr auto DeltaTime{1.0f / 60.0f};
+
+		FRandomStream RandomStream{ValuesCount};
+
+		TArray<float> Values;
+		TArray<float> Targets;
+		TArray<float> Lambdas;
+		TArray<float> Speeds;
+
+		Values.SetNumUninitialized(ValuesCount);
+		Targets.SetNumUninitialized(ValuesCount);
+		Lambdas.SetNumUninitialized(ValuesCount);
+		Speeds.SetNumUninitialized(ValuesCount);
+
+		for (auto i{0}; i < ValuesCount; i++)
+		{
+			Values[i] = RandomStream.FRandRange(-180.0f, 180.0f);
+			Targets[i] = RandomStream.FRandRange(-180.0f, 180.0f);
+			Lambdas[i] = RandomStream.FRandRange(0.0f, 20.0f);
+			Speeds[i] = RandomStream.FRandRange(0.0f, 720.0f);
+		}
+
+		auto ScalarValues{Values};
+		auto BatchValues{Values};
+
+		const auto Report{
+			[&](const TCHAR* Name, const double ScalarSeconds, const double BatchSeconds)
+			{
+				auto MaxError{0.0f};
+
+				for (auto i{0}; i < ValuesCount; i++)
+				{
+					MaxError = FMath::Max(MaxError, FMath::Abs(FMath::FindDeltaAngleDegrees(ScalarValues[i], BatchValues[i])));
+				}
+
+				UE_LOG(LogAls, Display, TEXT("%s: Scalar: %.3f ms, Batch: %.3f ms, Speedup: %.2fx, Max Error: %g."), Name,
+				       ScalarSeconds * 1000.0, BatchSeconds * 1000.0, ScalarSeconds / FMath::Max(BatchSeconds, UE_DOUBLE_SMALL_NUMBER),
+				       MaxError);
+
+				ScalarValues = Values;
+				BatchValues = Values;
+			}
+		};
+
+		UE_LOG(LogAls, Display, TEXT("Benchmarking batch math with %d values and %d iterations."), ValuesCount, IterationsCount);
+
+		Report(TEXT("ExponentialDecay"),
+		       MeasureSeconds(IterationsCount, [&]
+		       {
+			       for (auto i{0}; i < ValuesCount; i++)
+			       {
+				       ScalarValues[i] = UAlsMath::ExponentialDecay(ScalarValues[i], Targets[i], DeltaTime, Lambdas[i]);
+			       }
+		       }),
+		       MeasureSeconds(IterationsCount, [&]
+		       {
+			       AlsMathBatch::ExponentialDecay(BatchValues, Targets, Lambdas, DeltaTime);
+		       }));
+
+		Report(TEXT("ExponentialDecayAngle"),
+		       MeasureSeconds(IterationsCount, [&]
+		       {
+			       for (auto i{0}; i < ValuesCount; i++)
+			       {
+				       ScalarValues[i] = UAlsMath::ExponentialDecayAngle(ScalarValues[i], Targets[i], DeltaTime, Lambdas[i]);
+			       }
+		       }),
+		       MeasureSeconds(IterationsCount, [&]
+		       {
+			       AlsMathBatch::ExponentialDecayAngle(BatchValues, Targets, Lambdas, DeltaTime);
+		       }));
+
+		Report(TEXT("InterpolateAngleConstant"),
+		       MeasureSeconds(IterationsCount, [&]
+		       {
+			       for (auto i{0}; i < ValuesCount; i++)
+			       {
+				       ScalarValues[i] = UAlsMath::InterpolateAngleConstant(ScalarValues[i], Targets[i], DeltaTime, Speeds[i]);
+			       }
+		       }),
+		       MeasureSeconds(IterationsCount, [&]
+		       {
+			       AlsMathBatch::InterpolateAngleConstant(BatchValues, Targets, Speeds, DeltaTime);
+		       }));
+	}
+
+	static FAutoConsoleCommand Command{
+		TEXT("Als.BenchmarkBatchMath"),
+		TEXT("Compares the batch math functions to the scalar ones. Arguments: [ValuesCount=1024] [IterationsCount=1000]."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Run)
+	};
+}
+
+#endif
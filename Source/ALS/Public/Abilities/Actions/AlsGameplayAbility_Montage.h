@@ -15,7 +15,12 @@ class ALS_API UAlsGameplayAbility_Montage : public UAlsGameplayAbility_MontageBa
 
 protected:
 	UPROPERTY(EditDefaultsOnly, Category = "AlsAbility|Montage")
-	TObjectPtr<UAnimMontage> MontageToPlay;
+	TSoftObjectPtr<UAnimMontage> SoftMontageToPlay;
+
+#if WITH_EDITORONLY_DATA
+	UPROPERTY(Meta = (DeprecatedProperty, DeprecationMessage = "Use SoftMontageToPlay instead."))
+	TObjectPtr<UAnimMontage> MontageToPlay_DEPRECATED;
+#endif
 
 	UPROPERTY(EditDefaultsOnly, Category = "AlsAbility|Montage")
 	float PlayRate{1.0f};
@@ -26,6 +31,11 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "AlsAbility|Montage", Meta = (ForceUnit = "s"))
 	float StartTime;
 
+public:
+	virtual void PostLoad() override;
+
+	virtual void GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const override;
+
 protected:
 	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* OwnerInfo,
 								 const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override;
@@ -84,6 +84,7 @@ struct FAlsAbilitySet_GrantedHandles
 
 public:
 	void AddAbilitySpecHandle(const FGameplayAbilitySpecHandle& Handle);
+	void AddAbilitySpecHandles(TConstArrayView<FGameplayAbilitySpecHandle> Handles);
 	void AddGameplayEffectHandle(const FActiveGameplayEffectHandle& Handle);
 	void AddAttributeSet(UAttributeSet* Set);
 
@@ -120,6 +121,9 @@ public:
 	// The returned handles can be used later to take away anything that was granted.
 	void GiveToAbilitySystem(UAlsAbilitySystemComponent* AlsAsc, UObject* SourceObject, FAlsAbilitySet_GrantedHandles* OutGrantedHandles = nullptr) const;
 
+	// Collects the soft referenced assets used by the granted abilities, so they can be streamed in ahead of their first use.
+	void GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
 protected:
 	// Gameplay abilities to grant when this ability set is granted.
 	UPROPERTY(EditDefaultsOnly, Category = "Gameplay Abilities", meta = (TitleProperty = Ability))
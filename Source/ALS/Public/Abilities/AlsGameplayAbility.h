@@ -15,8 +15,15 @@ struct ALS_API FAlsPlayMontageParameter
 {
 	GENERATED_BODY()
 
+	// Soft referenced so that montages are only loaded for abilities that are actually granted. Streamed
+	// in when the ability set is preloaded, loaded synchronously on first use if that hasn't finished yet.
 	UPROPERTY(EditDefaultsOnly, Category = AlsMontageAbility)
-	TObjectPtr<UAnimMontage> MontageToPlay;
+	TSoftObjectPtr<UAnimMontage> SoftMontageToPlay;
+
+#if WITH_EDITORONLY_DATA
+	UPROPERTY(Meta = (DeprecatedProperty, DeprecationMessage = "Use SoftMontageToPlay instead."))
+	TObjectPtr<UAnimMontage> MontageToPlay_DEPRECATED;
+#endif
 
 	UPROPERTY(EditDefaultsOnly, Category = AlsMontageAbility)
 	float PlayRate{1.0f};
@@ -26,6 +33,20 @@ struct ALS_API FAlsPlayMontageParameter
 
 	UPROPERTY(EditDefaultsOnly, Category = AlsMontageAbility, Meta = (ForceUnit = "s"))
 	float StartTime{0.0f};
+
+public:
+	UAnimMontage* LoadMontage() const;
+
+	void PostSerialize(const FArchive& Archive);
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsPlayMontageParameter> : public TStructOpsTypeTraitsBase2<FAlsPlayMontageParameter>
+{
+	enum
+	{
+		WithPostSerialize = true
+	};
 };
 
 /**
@@ -52,6 +73,10 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = AlsAbility)
 	float OverrideBlendOutTimeOnEndAbility{-1.0f};
 
+	// Assets streamed in together with the ability set that grants this ability, e.g. montages selected at runtime.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = AlsAbility)
+	TArray<TSoftObjectPtr<UObject>> PreloadAssets;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AlsAbility|State", Transient)
 	uint8 bInputBinded : 1{false};
 
@@ -64,6 +89,8 @@ public:
 
 	virtual UWorld* GetWorld() const override;
 
+	virtual void GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
 protected:
 	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
 								 const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override;
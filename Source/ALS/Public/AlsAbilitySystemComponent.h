@@ -8,6 +8,8 @@ class UEnhancedInputComponent;
 class UInputAction;
 class AAlsCharacter;
 
+DECLARE_EVENT_OneParam(UAlsAbilitySystemComponent, FAlsAbilitySystem_OnInputActivation, const FGameplayTag&);
+
 /**
  * AbilitySystemComponent for ALS Refactored
  */
@@ -25,6 +27,8 @@ protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "ALS|AbilitySystem")
 	void OnRefresh(float DeltaTime);
 
+	virtual void OnTagUpdated(const FGameplayTag& Tag, bool bTagExists) override;
+
 	UFUNCTION(BlueprintCallable, Category = "ALS|AbilitySystem", DisplayName = "CancelAbilityByTags",
 			  Meta = (ScriptName = "CancelAbilityByTags", AutoCreateRefTerm = "Tags"))
 	void K2_CancelAbilityByTags(const FGameplayTagContainer& Tags)
@@ -53,6 +57,10 @@ public:
 		return TryActivateAbilitiesByTag(FGameplayTagContainer{Tag}, bAllowRemoteActivation);
 	}
 
+	// Same as calling GiveAbility() for each spec, but the ability list is locked, grown and marked dirty only once
+	// and the whole batch is sent in a single replication update. Invalid specs are skipped without a handle.
+	void GiveAbilities(TConstArrayView<FGameplayAbilitySpec> Specs, TArray<FGameplayAbilitySpecHandle>& OutHandles);
+
 	// Input binding
 
 public:
@@ -60,8 +68,15 @@ public:
 
 	void UnbindAbilityInputs(UEnhancedInputComponent* EnhancedInputComponent, const FGameplayTag& InputTag);
 
+	// Broadcast before trying to activate abilities from an input action bound through BindAbilityActivationInput().
+	FAlsAbilitySystem_OnInputActivation OnInputActivation;
+
 private:
 	TMap<FGameplayTag, TArray<uint32>> BindingHandles;
 
+	uint8 bBlueprintRefreshImplemented : 1{false};
+
+	void HandleRefresh(float DeltaTime);
+
 	void ActivateOnInputAction(FGameplayTag InputTag);
 };
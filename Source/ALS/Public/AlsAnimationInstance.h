@@ -11,6 +11,7 @@
 #include "State/AlsMovementBaseState.h"
 #include "State/AlsPoseState.h"
 #include "State/AlsRotateInPlaceState.h"
+#include "State/AlsStateTagBits.h"
 #include "State/AlsTransitionsState.h"
 #include "State/AlsTurnInPlaceState.h"
 #include "Utility/AlsGameplayTags.h"
@@ -23,6 +24,7 @@ class UAlsLayeringAnimInstance;
 class UAlsViewAnimInstance;
 class UAlsRagdollingAnimInstance;
 class AAlsCharacter;
+class UAlsTurnInPlaceSettings;
 
 UCLASS()
 class ALS_API UAlsAnimationInstance : public UAnimInstance
@@ -66,6 +68,10 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bIsActionRunning : 1{false};
 
+	// True on dedicated servers when the dedicated server profile is enabled in the settings.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	uint8 bDedicatedServerProfile : 1{false};
+
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bDisplayDebugTraces : 1{false};
@@ -74,6 +80,17 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FGameplayTagContainer CurrentGameplayTags;
 
+	// Mirror of the built-in ALS tags from CurrentGameplayTags. Refreshed together with it.
+	EAlsStateTagBits CurrentStateTagBits{EAlsStateTagBits::None};
+
+	// Character gameplay tags generation that CurrentGameplayTags was last refreshed from.
+	TOptional<uint32> CurrentGameplayTagsGeneration;
+
+	// Incremented every time CurrentGameplayTags is rebuilt. Can be bound to the container version
+	// of the "ALS Gameplay Tags Blend" node so it only re-evaluates its tag matches on changes.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	int32 CurrentGameplayTagsVersion{0};
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FGameplayTag FaceRotationMode{AlsRotationModeTags::ViewDirection};
 
@@ -110,6 +127,11 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FHitResult GroundHit;
 
+	// Refreshed in place at the end of the worker thread update, after all of its sources. Bind the control rig
+	// input to this property rather than to GetControlRigInput(), so the animation graph can copy it directly.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsControlRigInput ControlRigInput;
+
 public:
 	//This is in the process of organizing such that things that are only accessed within each LinkedAnimLayer are defined within the LinkedAnimLayer,
 	//and only those that are referenced across multiple LinkedAnimLayers are held in the AlsAnimationInstance.
@@ -121,6 +143,8 @@ public:
 
 	const FGameplayTagContainer& GetCurrentGameplayTags() const;
 
+	bool HasStateTag(EAlsStateTagBits StateTagBit) const;
+
 public:
 	virtual void NativeInitializeAnimation() override;
 
@@ -148,12 +172,17 @@ protected:
 
 	mutable TArray<TFunction<void()>> RequestQueue;
 
+private:
+	void RefreshControlRigInput();
+
 public:
 	void MarkPendingUpdate();
 
 	void MarkTeleported();
 
 private:
+	void RefreshGameplayTagsOnGameThread();
+
 	void RefreshMovementBaseOnGameThread();
 
 	void RefreshPose();
@@ -241,17 +270,20 @@ private:
 
 	void RefreshFeet(float DeltaTime);
 
+	FAlsFeetRefreshContext MakeFeetRefreshContext(float DeltaTime) const;
+
 	void RefreshFoot(FAlsFootState& FootState, const FName& FootIkCurveName, const FName& FootLockCurveName,
-	                 const FAlsFootLimitsSettings& LimitsSettings, const FTransform& ComponentTransformInverse, float DeltaTime) const;
+	                 const FAlsFootLimitsSettings& LimitsSettings, const FAlsFeetRefreshContext& Context) const;
 
-	void ProcessFootLockTeleport(FAlsFootState& FootState) const;
+	void ProcessFootLockTeleport(FAlsFootState& FootState, const FAlsFeetRefreshContext& Context) const;
 
-	void ProcessFootLockBaseChange(FAlsFootState& FootState, const FTransform& ComponentTransformInverse) const;
+	void ProcessFootLockBaseChange(FAlsFootState& FootState, const FAlsFeetRefreshContext& Context) const;
 
-	void RefreshFootLock(FAlsFootState& FootState, const FName& FootLockCurveName, const FTransform& ComponentTransformInverse,
-	                     float DeltaTime, FVector& FinalLocation, FQuat& FinalRotation) const;
+	void RefreshFootLock(FAlsFootState& FootState, const FName& FootLockCurveName, const FAlsFeetRefreshContext& Context,
+	                     FVector& FinalLocation, FQuat& FinalRotation) const;
 
-	void RefreshFootOffset(FAlsFootState& FootState, float DeltaTime, FVector& FinalLocation, FQuat& FinalRotation) const;
+	void RefreshFootOffset(FAlsFootState& FootState, const FAlsFeetRefreshContext& Context,
+	                       FVector& FinalLocation, FQuat& FinalRotation) const;
 
 	void LimitFootRotation(const FAlsFootLimitsSettings& LimitsSettings, const FQuat& ParentRotation, FQuat& Rotation) const;
 
@@ -303,6 +335,8 @@ private:
 
 	void PlayQueuedTurnInPlaceAnimation();
 
+	void ApplyTurnInPlaceSettings(const UAlsTurnInPlaceSettings& TurnInPlaceSettings, float TurnYawAngle);
+
 	// Ragdolling
 
 public:
@@ -319,6 +353,11 @@ inline const FGameplayTagContainer& UAlsAnimationInstance::GetCurrentGameplayTag
 	return CurrentGameplayTags;
 }
 
+inline bool UAlsAnimationInstance::HasStateTag(const EAlsStateTagBits StateTagBit) const
+{
+	return EnumHasAnyFlags(CurrentStateTagBits, StateTagBit);
+}
+
 inline UAlsAnimationInstanceSettings* UAlsAnimationInstance::GetSettingsUnsafe() const
 {
 	return Settings;
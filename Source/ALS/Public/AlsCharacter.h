@@ -1,6 +1,8 @@
 #pragma once
 
 #include "GameFramework/Character.h"
+#include "Engine/StreamableManager.h"
+#include "State/AlsLocomotionHistory.h"
 #include "State/AlsLocomotionState.h"
 #include "State/AlsMovementBaseState.h"
 #include "State/AlsViewState.h"
@@ -32,6 +34,8 @@ DECLARE_EVENT_OneParam(AAlsCharacter, FAlsCharacter_OnRefresh, float);
 
 DECLARE_EVENT_OneParam(AAlsCharacter, FAlsCharacter_OnChangeGameplayTag, const FGameplayTag &);
 
+DECLARE_EVENT(AAlsCharacter, FAlsCharacter_OnStateChanged);
+
 UCLASS(Abstract, AutoExpandCategories = ("Als Character|Settings"))
 class ALS_API AAlsCharacter : public ACharacter, public IAbilitySystemInterface, public IGameplayCueInterface, public IGameplayTagAssetInterface
 {
@@ -169,6 +173,30 @@ public:
 
 	FAlsCharacter_OnRefresh OnRefresh;
 
+	// Broadcast when the locomotion mode, rotation mode, stance or input presence changes. Allows
+	// to react to these changes without polling the character state every frame.
+	FAlsCharacter_OnStateChanged OnStateChanged;
+
+	// Subscribes to OnStateChanged on behalf of the montage instance playing on the animation instance, replacing its previous
+	// subscription. Subscriptions of montage instances that no longer exist are removed the next time any montage instance subscribes.
+	void SubscribeMontageToStateChanged(UAnimInstance& MontageAnimationInstance, int32 MontageInstanceID,
+	                                    FAlsCharacter_OnStateChanged::FDelegate&& Delegate);
+
+	void UnsubscribeMontageFromStateChanged(int32 MontageInstanceID);
+
+private:
+	struct FMontageStateChangedSubscription
+	{
+		TWeakObjectPtr<UAnimInstance> AnimationInstance;
+
+		FDelegateHandle Handle;
+	};
+
+	TMap<int32, FMontageStateChangedSubscription> MontageStateChangedSubscriptions;
+
+public:
+	virtual void PostNetReceive() override;
+
 	virtual void PostNetReceiveLocationAndRotation() override;
 
 	virtual void OnRep_ReplicatedBasedMovement() override;
@@ -179,6 +207,19 @@ public:
 
 	virtual void Restart() override;
 
+	// Starts streaming in the assets asynchronously and keeps them loaded while the character exists.
+	TSharedPtr<FStreamableHandle> PreloadAssets(TArray<FSoftObjectPath>&& Assets, FStreamableDelegate&& OnLoaded = {});
+
+	// Returns true once all assets requested through PreloadAssets() have been loaded. Soft referenced
+	// assets that are still streaming can be used anyway, but are loaded synchronously on first use.
+	UFUNCTION(BlueprintPure, Category = "ALS|Character")
+	bool IsAssetPreloadComplete() const;
+
+private:
+	// Keyed by asset, so that requesting the same asset again replaces its handle instead of adding a new one.
+	TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> AssetPreloadHandles;
+
+public:
 	// IAbilitySystemInterface
 
 	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
@@ -192,9 +233,17 @@ public:
 
 	void ReplaceAlsAbilitySystem(UAlsAbilitySystemComponent *NewAbilitySystem);
 
+	// Incremented every time any of the owned gameplay tags may have changed. Can be used
+	// to cache results of gameplay tag queries until the character's tags actually change.
+	uint32 GetGameplayTagsGeneration() const;
+
+	void MarkGameplayTagsChanged();
+
 private:
 	mutable FGameplayTagContainer TempTagContainer;
 
+	uint32 GameplayTagsGeneration{0};
+
 	void RefreshMeshProperties() const;
 
 	void RefreshMovementBase();
@@ -366,6 +415,31 @@ public:
 private:
 	void TryAdjustControllRotation(float DeltaTime);
 
+	// Crowd Mode
+
+public:
+	UFUNCTION(BlueprintPure, Category = "ALS|Character")
+	bool IsCrowdModeEnabled() const;
+
+	// Crowd mode is intended for ambient AI characters moved by path following on the server. The path following velocity
+	// is applied directly instead of through acceleration and is used as the input direction, and the view and rotation
+	// are refreshed at UAlsCharacterSettings::CrowdModeUpdateInterval instead of every frame.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character")
+	void SetCrowdModeEnabled(bool bEnabled);
+
+private:
+	// Returns true if the view and rotation should be refreshed this frame. In crowd mode, the time
+	// accumulated since the last refresh is returned through DeltaTime.
+	bool TryConsumeCrowdModeDeltaTime(float& DeltaTime);
+
+	uint8 bCrowdMode : 1 {false};
+
+	uint8 bPreviousUseAccelerationForPaths : 1 {true};
+
+	uint8 bPreviousRequestedMoveUseAcceleration : 1 {true};
+
+	float CrowdModeDeltaTime{0.0f};
+
 	// View
 
 public:
@@ -412,6 +486,23 @@ private:
 
 	void RefreshLocomotionLate(float DeltaTime);
 
+	// Locomotion History
+
+public:
+	const FAlsLocomotionHistory& GetLocomotionHistory() const;
+
+	// Returns the state the character was in at the given world time, interpolated from the locomotion history.
+	// Returns false if the history doesn't go back that far, see UAlsCharacterSettings::LocomotionHistoryCapacity.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character", Meta = (ReturnDisplayName = "Success"))
+	bool SampleLocomotionHistory(double Time, FAlsLocomotionHistorySample& Sample) const;
+
+private:
+	void RefreshLocomotionHistory();
+
+	FAlsLocomotionHistory LocomotionHistory;
+
+	double LocomotionHistoryRecordTime{0.0};
+
 	// Jumping
 
 public:
@@ -521,10 +612,26 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Als Character|State", replicatedUsing = OnRep_IsLied)
 	uint32 bIsLied : 1;
 
+private:
+	// Default eye height and capsule size, cached on initialization so that the class default object
+	// doesn't have to be looked up every frame.
+	float DefaultEyeHeight{0.0f};
+
+	float DefaultCapsuleHalfHeight{0.0f};
+
+	float DefaultCapsuleRadius{0.0f};
+
+	// Capsule half height the capsule has settled at. While settled, the capsule size is not updated
+	// until the target size changes or the capsule is resized by something else.
+	float SettledCapsuleHalfHeight{-1.0f};
+
+	uint8 bCapsuleSettled : 1 {false};
+
 private:
 	void RefreshCapsuleSize(float DeltaTime);
 
-	void UpdateCapsule(float DeltaTime, float EyeHeight, float EyeHeightSpeed, float HalfHeight, float HalfHeightSpeed, float Radius, float RadiusSpeed);
+	// Returns true if the eye height and capsule size have reached their targets.
+	bool UpdateCapsule(float DeltaTime, float EyeHeight, float EyeHeightSpeed, float HalfHeight, float HalfHeightSpeed, float Radius, float RadiusSpeed);
 
 	/** Handle Lying replicated from server */
 	UFUNCTION()
@@ -563,6 +670,16 @@ inline void AAlsCharacter::ReplaceAlsAbilitySystem(UAlsAbilitySystemComponent* N
 	AbilitySystem = NewAbilitySystem;
 }
 
+inline uint32 AAlsCharacter::GetGameplayTagsGeneration() const
+{
+	return GameplayTagsGeneration;
+}
+
+inline void AAlsCharacter::MarkGameplayTagsChanged()
+{
+	++GameplayTagsGeneration;
+}
+
 inline const FGameplayTag& AAlsCharacter::GetDesiredRotationMode() const
 {
 	return DesiredRotationMode;
@@ -613,6 +730,11 @@ inline const FVector& AAlsCharacter::GetInputDirection() const
 	return InputDirection;
 }
 
+inline bool AAlsCharacter::IsCrowdModeEnabled() const
+{
+	return bCrowdMode;
+}
+
 inline const FAlsViewState& AAlsCharacter::GetViewState() const
 {
 	return ViewState;
@@ -623,6 +745,11 @@ inline const FAlsLocomotionState& AAlsCharacter::GetLocomotionState() const
 	return LocomotionState;
 }
 
+inline const FAlsLocomotionHistory& AAlsCharacter::GetLocomotionHistory() const
+{
+	return LocomotionHistory;
+}
+
 inline bool AAlsCharacter::IsLied() const
 {
 	return bIsLied;
@@ -14,6 +14,11 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Transient, Category = "AlsCharacterComponent|State")
 	TWeakObjectPtr<AAlsCharacter> Character;
 
+public:
+	// Collects the soft referenced assets the component needs right after the character begins play,
+	// so that the character can stream them in together with the assets of its ability set.
+	virtual void GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const {}
+
 protected:
 	template<class T>
 	static T* NewTask(const UClass* Class)
@@ -28,4 +33,9 @@ protected:
 
 	UFUNCTION(BlueprintNativeEvent, Category = "ALS|CharacterComponent")
 	void OnRefresh(float DeltaTime);
+
+private:
+	uint8 bBlueprintRefreshImplemented : 1{false};
+
+	void HandleRefresh(float DeltaTime);
 };
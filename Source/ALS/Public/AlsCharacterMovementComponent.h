@@ -144,6 +144,29 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AlsCharacterMovement|State", Transient)
 	uint8 bPrePenetrationAdjustmentVelocityValid : 1 {false};
 
+	// During capsule size interpolation, the capsule is only resized once the interpolated size differs from the
+	// current one by at least this amount, or once the target size is reached. Each resize updates the physics
+	// shape and overlaps, so larger steps are cheaper but make the transition less smooth. Zero resizes every frame.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Movement (General Settings)", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float CapsuleResizeStep{2.0f};
+
+	// Capsule size interpolated towards the target size, may be ahead of the actual capsule size by less than a resize step.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AlsCharacterMovement|State", Transient)
+	FVector2f InterpolatedCapsuleSize{-1.0f, -1.0f};
+
+	// Capsule size set by the last resize, used to detect capsule size changes made outside of the interpolation.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AlsCharacterMovement|State", Transient)
+	FVector2f AppliedCapsuleSize{-1.0f, -1.0f};
+
+	// How long a blocked stand up encroachment test result is reused by UnCrouch() and UnLie() while the character
+	// stays in place. Limits how late the character notices that the geometry above it has moved away. Zero disables the cache.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Movement (General Settings)", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float EncroachmentCacheLifetime{0.2f};
+
+	// Number of stand up encroachment tests skipped because of a cached blocked result.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AlsCharacterMovement|State", Transient)
+	int32 SkippedEncroachmentTestCount{0};
+
 public:
 	FAlsPhysicsRotationDelegate OnPhysicsRotation;
 
@@ -233,6 +256,9 @@ public:
 
 	bool TryConsumePrePenetrationAdjustmentVelocity(FVector& OutVelocity);
 
+	// Returns true if path following has requested a velocity through RequestDirectMove() that is not yet cleared.
+	bool TryGetRequestedVelocity(FVector& OutVelocity) const;
+
 public:
 	/** If true, try to lie (or keep lying down) on next update. If false, try to stop lying on next update. */
 	UPROPERTY(Category = "Character Movement (General Settings)", VisibleInstanceOnly, BlueprintReadOnly)
@@ -254,7 +280,8 @@ public:
 	
 	TObjectPtr<class AAlsCharacter> GetAlsCharacter() const;
 
-	virtual void UpdateCapsuleSize(float DeltaTime, float TargetHalfHeight, float HeightSpeed, float TargetRadius, float RadiusSpeed);
+	// Returns true if the capsule has reached the target size.
+	virtual bool UpdateCapsuleSize(float DeltaTime, float TargetHalfHeight, float HeightSpeed, float TargetRadius, float RadiusSpeed);
 
 protected:
 	/* Prepare inputs for asynchronous simulation on physics thread */
@@ -268,11 +295,37 @@ protected:
 	virtual void RegisterAsyncCallback() override;
 	virtual bool IsAsyncCallbackRegistered() const override;
 
+private:
+	// Returns true if the stand up encroachment test has recently failed at the same location,
+	// with the same capsule size and on the same movement base, so it doesn't need to be repeated.
+	bool IsStandUpEncroachmentCached(const FVector& PawnLocation, float UnscaledHalfHeight);
+
+	void CacheStandUpEncroachment(const FVector& PawnLocation, float UnscaledHalfHeight);
+
 private:
 	FAlsCharacterMovementComponentAsyncCallback* AlsAsyncCallback;
+
+	FVector EncroachmentCacheLocation{ForceInit};
+
+	float EncroachmentCacheHalfHeight{-1.0f};
+
+	double EncroachmentCacheTime{-1.0};
+
+	TWeakObjectPtr<UPrimitiveComponent> EncroachmentCacheMovementBase;
 };
 
 inline const FAlsMovementGaitSettings& UAlsCharacterMovementComponent::GetGaitSettings() const
 {
 	return GaitSettings;
 }
+
+inline bool UAlsCharacterMovementComponent::TryGetRequestedVelocity(FVector& OutVelocity) const
+{
+	if (!bHasRequestedVelocity)
+	{
+		return false;
+	}
+
+	OutVelocity = RequestedVelocity;
+	return true;
+}
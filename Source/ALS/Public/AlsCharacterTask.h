@@ -1,12 +1,26 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
 #include "AlsCharacterTask.generated.h"
 
 class UWorld;
 class AActor;
 class UAlsCharacterComponent;
 
+UENUM(BlueprintType)
+enum class EAlsCharacterTaskRefreshMode : uint8
+{
+	// Refresh is called every character tick.
+	EveryFrame,
+	// Refresh is called once per refresh interval with the accumulated delta time.
+	FixedRate,
+	// Refresh is called only when the character's gameplay tags have changed.
+	OnTagChange,
+	// Refresh is never called. The task reacts only to begin, end and input events.
+	Never
+};
+
 UCLASS(Abstract, Blueprintable, BlueprintType, AutoExpandCategories = ("Settings"))
 class ALS_API UAlsCharacterTask : public UObject
 {
@@ -16,6 +30,18 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Settings")
 	uint8 bEnableInputBinding : 1{true};
 
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Settings")
+	EAlsCharacterTaskRefreshMode RefreshMode{EAlsCharacterTaskRefreshMode::EveryFrame};
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "s",
+		EditCondition = "RefreshMode == EAlsCharacterTaskRefreshMode::FixedRate", EditConditionHides))
+	float RefreshInterval{0.1f};
+
+	// If empty, any change of the character's gameplay tags triggers refresh.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Settings",
+		Meta = (EditCondition = "RefreshMode == EAlsCharacterTaskRefreshMode::OnTagChange", EditConditionHides))
+	FGameplayTagContainer RefreshTriggerTags;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	TWeakObjectPtr<AAlsCharacter> Character;
 
@@ -28,6 +54,20 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bEpilogRunningCurrently : 1{false};
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	uint8 bBlueprintRefreshImplemented : 1{false};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ForceUnits = "s"))
+	float PendingRefreshDeltaTime{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FGameplayTagContainer LastTriggerTags;
+
+	uint32 LastGameplayTagsGeneration{0};
+
+	// The first refresh after the task begins is always performed, even if none of the trigger tags are owned.
+	uint8 bInitialRefreshPending : 1{false};
+
 public:
 	virtual bool IsActive() const { return bActive; }
 
@@ -35,6 +75,10 @@ public:
 
 	virtual void Begin();
 
+	// Called by the owning component every character tick. Decides, based on the refresh mode,
+	// whether the task needs to be refreshed this frame and calls Refresh() if so.
+	void TickRefresh(float DeltaTime);
+
 	virtual void Refresh(float DeltaTime);
 
 	virtual void OnControllerChanged(AController* PreviousController, AController* NewController);
@@ -58,6 +102,11 @@ protected:
 
 	virtual void OnFinished();
 
+	// Called right after the task has been activated or deactivated.
+	virtual void OnActiveChanged();
+
+	bool HaveTriggerTagsChanged();
+
 	void BindInput(UInputComponent* InputComponent);
 
 	void UnbindInput(UInputComponent* InputComponent);
@@ -31,6 +31,48 @@ struct ALS_API FAlsMotionWarpingTargetSmall
 	TWeakObjectPtr<const USceneComponent> Component;
 };
 
+/** Warp target sent to simulated proxies by UAlsMotionWarpingComponent::MulticastAddOrUpdateWarpTarget().
+ * Rotations without pitch and roll, which is the usual case for traversal actions, are sent as a single quantized yaw.
+ */
+USTRUCT()
+struct ALS_API FAlsReplicatedWarpTarget
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName Name;
+
+	UPROPERTY()
+	FVector_NetQuantize Location;
+
+	UPROPERTY()
+	FRotator Rotation{ForceInitToZero};
+
+	UPROPERTY()
+	TWeakObjectPtr<const USceneComponent> Component;
+
+	UPROPERTY()
+	FName BoneName;
+
+	UPROPERTY()
+	uint8 bFromComponent : 1 {false};
+
+	UPROPERTY()
+	uint8 bFollowComponent : 1 {false};
+
+public:
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsReplicatedWarpTarget> : public TStructOpsTypeTraitsBase2<FAlsReplicatedWarpTarget>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
 /**
  * 
  */
@@ -56,12 +98,15 @@ private:
 	UFUNCTION(Server, Reliable)
 	void ServerAddOrUpdateWarpTargetFromLocationAndRotation(FName WarpTargetName, FVector_NetQuantize TargetLocation, FRotator TargetRotation);
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastAddOrUpdateWarpTargetFromLocationAndRotation(FName WarpTargetName, FVector_NetQuantize TargetLocation, FRotator TargetRotation);
-
 	UFUNCTION(Server, Reliable)
 	void ServerAddOrUpdateWarpTargetFromComponent(FName WarpTargetName, const USceneComponent* Component, FName BoneName, bool bFollowComponent);
 
+	// Reliable, so that warp targets stay ordered with other reliable RPCs of the character, such as
+	// UAlsLocalMontageComponent::MulticastPlay(), and are never re-applied to characters that become relevant later.
 	UFUNCTION(NetMulticast, Reliable)
-	void MulticastAddOrUpdateWarpTargetFromComponent(FName WarpTargetName, const USceneComponent* Component, FName BoneName, bool bFollowComponent);
+	void MulticastAddOrUpdateWarpTarget(const FAlsReplicatedWarpTarget& WarpTarget);
+
+	void ReplicateWarpTargetFromLocationAndRotation(const FName& WarpTargetName, const FVector& TargetLocation, const FRotator& TargetRotation);
+
+	void ReplicateWarpTargetFromComponent(const FName& WarpTargetName, const USceneComponent* Component, const FName& BoneName, bool bFollowComponent);
 };
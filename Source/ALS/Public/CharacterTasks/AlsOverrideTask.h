@@ -31,8 +31,8 @@ protected:
 public:
 	virtual void Begin() override;
 
-	virtual void Refresh(float DeltaTime) override;
-
 protected:
+	virtual void OnActiveChanged() override;
+
 	virtual void OnFinished() override;
 };
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "AlsCharacterComponent.h"
+#include "GameplayTagContainer.h"
+#include "AlsInputRecorderComponent.generated.h"
+
+USTRUCT()
+struct ALS_API FAlsInputRecordingFrame
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	float DeltaTime{0.0f};
+
+	UPROPERTY()
+	FVector MovementInput{ForceInit};
+
+	UPROPERTY()
+	FRotator ControlRotation{ForceInit};
+
+	// Input tags of the abilities that were activated by input during the frame.
+	UPROPERTY()
+	TArray<FGameplayTag> AbilityInputTags;
+};
+
+USTRUCT()
+struct ALS_API FAlsInputRecording
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector StartLocation{ForceInit};
+
+	UPROPERTY()
+	FRotator StartRotation{ForceInit};
+
+	UPROPERTY()
+	TArray<FAlsInputRecordingFrame> Frames;
+};
+
+// Records the movement input, control rotation and ability input activations of the character every frame, and replays
+// them later to reproduce the same session without a player, for example on a server started with -nullrhi. The replayed
+// character still needs a controller to be moved. While replaying, the engine runs with a fixed time step set to the
+// recorded delta time of each frame, so that the frames line up regardless of how long they take. Use the
+// Als.InputRecording.Start, Als.InputRecording.Stop and Als.InputRecording.Replay console commands to control all input
+// recorder components in the world at once.
+UCLASS(ClassGroup = "ALS", Meta = (BlueprintSpawnableComponent), AutoExpandCategories = ("AlsInputRecorderComponent|Settings"))
+class ALS_API UAlsInputRecorderComponent : public UAlsCharacterComponent
+{
+	GENERATED_UCLASS_BODY()
+
+protected:
+	// Identifies the recordings of this component when all input recorder components are controlled by the console commands at
+	// once. If not set, player controlled characters are identified by the index of their player controller, and other
+	// characters are skipped, since their names and spawn order can change between the recording and the replay.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AlsInputRecorderComponent|Settings")
+	FName RecorderId;
+
+	// If checked, a stats file including the STATGROUP_Als cycle counters is captured while
+	// replaying, see the "stat StartFile" console command. Requires a build with stats enabled.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AlsInputRecorderComponent|Settings")
+	uint8 bCaptureStatsWhileReplaying : 1 {true};
+
+private:
+	FAlsInputRecording Recording;
+
+	TArray<FGameplayTag> PendingAbilityInputTags;
+
+	FDelegateHandle InputActivationHandle;
+
+	int32 ReplayFrameIndex{INDEX_NONE};
+
+	double ReplayStartTime{0.0};
+
+	int32 ReplayDeltaTimeMismatchesCount{0};
+
+	uint8 bRecording : 1 {false};
+
+	uint8 bCapturingStats : 1 {false};
+
+public:
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	static FString GetRecordingFilePath(const FString& RecordingName);
+
+	// Returns the identifier used to name the recordings of this component by the console commands, or an empty string if there is none.
+	FString GetRecorderId() const;
+
+	UFUNCTION(BlueprintPure, Category = "ALS|InputRecorder")
+	bool IsRecording() const;
+
+	UFUNCTION(BlueprintPure, Category = "ALS|InputRecorder")
+	bool IsReplaying() const;
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|InputRecorder")
+	void StartRecording();
+
+	// Stops recording and saves the recording to the file returned by GetRecordingFilePath().
+	UFUNCTION(BlueprintCallable, Category = "ALS|InputRecorder", Meta = (ReturnDisplayName = "Success"))
+	bool StopRecording(const FString& RecordingName);
+
+	// Loads the recording from the file returned by GetRecordingFilePath(), moves the character to
+	// where the recording started and feeds the recorded input to the character frame by frame.
+	UFUNCTION(BlueprintCallable, Category = "ALS|InputRecorder", Meta = (ReturnDisplayName = "Success"))
+	bool StartReplay(const FString& RecordingName);
+
+	// Stops replaying, restores the previous engine time step and logs the frame time summary of the replay.
+	UFUNCTION(BlueprintCallable, Category = "ALS|InputRecorder")
+	void StopReplay();
+
+private:
+	void StartTicking();
+
+	void StopTicking();
+
+	void OnInputActivation(const FGameplayTag& InputTag);
+
+	void RecordFrame(float DeltaTime);
+
+	void ReplayFrame(float DeltaTime);
+
+	// The engine applies the fixed delta time starting from the next frame, so it must be set one frame ahead.
+	void SetReplayDeltaTime(int32 FrameIndex) const;
+};
+
+inline bool UAlsInputRecorderComponent::IsRecording() const
+{
+	return bRecording;
+}
+
+inline bool UAlsInputRecorderComponent::IsReplaying() const
+{
+	return ReplayFrameIndex != INDEX_NONE;
+}
@@ -47,7 +47,4 @@ private:
 	void MulticastPlay(const FGameplayTag& LocalMontageTag);
 
 	UAlsLocalMontageTask* PlayImplementation(const FGameplayTag& LocalMontageTag);
-
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastAddOrUpdateWarpTargetFromLocationAndRotation(FName WarpTargetName, FVector_NetQuantize TargetLocation, FRotator TargetRotation);
 };
@@ -11,8 +11,15 @@ class ALS_API UAlsOverlayModeComponent : public UAlsCharacterComponent
 	GENERATED_BODY()
 
 protected:
+	// Soft referenced so that only the overlays that are actually used are loaded. An overlay that is not loaded yet
+	// is streamed in when it is selected, the previous overlay stays active until streaming has finished.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AlsOverlayModeComponent|Settings", Meta = (DisplayThumbnail = false))
-	TMap<FGameplayTag, TSubclassOf<UAlsOverlayTask>> OverlayClassMap;
+	TMap<FGameplayTag, TSoftClassPtr<UAlsOverlayTask>> OverlayTaskClassMap;
+
+#if WITH_EDITORONLY_DATA
+	UPROPERTY(Meta = (DeprecatedProperty, DeprecationMessage = "Use OverlayTaskClassMap instead."))
+	TMap<FGameplayTag, TSubclassOf<UAlsOverlayTask>> OverlayClassMap_DEPRECATED;
+#endif
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AlsOverlayModeComponent|State", Transient)
 	TWeakObjectPtr<UAlsOverlayTask> CurrentOverlayTask;
@@ -20,6 +27,15 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AlsOverrideModeComponent|State", Transient)
 	TMap<FGameplayTag, TObjectPtr<UAlsOverlayTask>> InstancedOverlayTasks;
 
+public:
+	virtual void PostLoad() override;
+
+	virtual void GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const override;
+
+	// Replaces reading the OverlayClassMap property, which was renamed to OverlayTaskClassMap when it became soft referenced.
+	UFUNCTION(BlueprintPure, Category = "ALS|OverlayModeComponent")
+	const TMap<FGameplayTag, TSoftClassPtr<UAlsOverlayTask>>& GetOverlayClassMap() const;
+
 protected:
 	virtual void OnRegister() override;
 
@@ -34,3 +50,8 @@ protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "ALS|OverlayModeComponent")
 	void OnChangeOverlayMode(const FGameplayTag& PreviousOverlayMode);
 };
+
+inline const TMap<FGameplayTag, TSoftClassPtr<UAlsOverlayTask>>& UAlsOverlayModeComponent::GetOverlayClassMap() const
+{
+	return OverlayTaskClassMap;
+}
@@ -29,6 +29,11 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "ALS|State", Transient)
 	uint8 bFacingUpward : 1{false};
 
+private:
+	// Bones captured into the final pose snapshot from the component space transforms. Other
+	// bones keep their evaluated local transforms. Empty means all bones.
+	TBitArray<> SnapshotBonesMask;
+
 public:
 	FPoseSnapshot& GetFinalPoseSnapshot();
 
@@ -38,7 +43,12 @@ public:
 
 	void SetStartBlendTime(float NewStartBlendTime);
 
+	void SetSnapshotBones(const TArray<FName>& BoneNames);
+
 	void Refresh(const struct FAlsRagdollingState& State, bool bNewActive);
+
+private:
+	void CaptureFinalPose();
 };
 
 inline void UAlsRagdollingAnimInstance::SetStartBlendTime(float NewStartBlendTime)
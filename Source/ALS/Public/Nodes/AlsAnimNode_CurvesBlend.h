@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Animation/AnimCurveFilter.h"
 #include "Animation/AnimNodeBase.h"
 #include "AlsAnimNode_CurvesBlend.generated.h"
 
@@ -38,8 +39,16 @@ public:
 
 	UPROPERTY(EditAnywhere, Category = "Settings", Meta = (FoldProperty))
 	EAlsCurvesBlendMode BlendMode{EAlsCurvesBlendMode::BlendByAmount};
+
+	// If not empty, only these curves are taken from the curves pose, all other curves are ignored.
+	UPROPERTY(EditAnywhere, Category = "Settings", Meta = (FoldProperty))
+	TArray<FName> CurveNames;
 #endif
 
+private:
+	// Built from the curve names on initialization. Empty if all curves are taken from the curves pose.
+	UE::Anim::FCurveFilter CurveFilter;
+
 public:
 	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
 
@@ -55,4 +64,6 @@ public:
 	float GetBlendAmount() const;
 
 	EAlsCurvesBlendMode GetBlendMode() const;
+
+	const TArray<FName>& GetCurveNames() const;
 };
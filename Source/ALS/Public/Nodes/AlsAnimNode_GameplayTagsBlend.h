@@ -32,9 +32,25 @@ public:
 	TArray<FAlsGameplayTagContainerMatch> TagMatches;
 #endif
 
+	// Version of the container, for example UAlsAnimationInstance::CurrentGameplayTagsVersion. While it
+	// doesn't change, the previously found active child is reused. Negative values disable caching.
+	UPROPERTY(EditAnywhere, Category = Settings, Meta = (PinHiddenByDefault))
+	int32 ContainerVersion{INDEX_NONE};
+
+private:
+	int32 CachedContainerVersion{INDEX_NONE};
+
+	int32 CachedActiveChildIndex{0};
+
+public:
+	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
+
 protected:
 	virtual int32 GetActiveChildIndex() override;
 
+private:
+	int32 FindActiveChildIndex() const;
+
 public:
 	const FGameplayTagContainer& GetContainer() const;
 
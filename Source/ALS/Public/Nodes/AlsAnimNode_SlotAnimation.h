@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Animation/AnimNodeBase.h"
+#include "State/AlsSlotAnimationRequest.h"
+#include "AlsAnimNode_SlotAnimation.generated.h"
+
+class UAnimSequenceBase;
+
+// Plays animations requested through FAlsSlotAnimationRequest on top of the source pose. Unlike a montage slot, the request
+// is picked up in the same animation update it was made in, and no montage instance is allocated for it. Animations are
+// ticked as regular asset players, so root motion is only extracted if the animation instance root motion mode allows it.
+USTRUCT(BlueprintInternalUseOnly)
+struct ALS_API FAlsAnimNode_SlotAnimation : public FAnimNode_Base
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	FPoseLink SourcePose;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (PinShownByDefault))
+	FAlsSlotAnimationRequest Request;
+
+#if WITH_EDITORONLY_DATA
+	// Only requests with this slot name are played by this node. If none, all requests are played.
+	UPROPERTY(EditAnywhere, Category = "Settings", Meta = (FoldProperty))
+	FName SlotName;
+#endif
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<UAnimSequenceBase> Animation{nullptr};
+
+	float PlayRate{1.0f};
+
+	float BlendInDuration{0.0f};
+
+	float BlendOutDuration{0.0f};
+
+	float StopBlendOutDuration{0.0f};
+
+	float Time{0.0f};
+
+	float BlendWeight{0.0f};
+
+	int32 PlayCounter{0};
+
+	int32 StopCounter{0};
+
+	uint8 bStopping : 1 {false};
+
+	uint8 bRequestCountersInitialized : 1 {false};
+
+	FMarkerTickRecord MarkerTickRecord;
+
+	FDeltaTimeRecord DeltaTimeRecord;
+
+public:
+	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
+
+	virtual void CacheBones_AnyThread(const FAnimationCacheBonesContext& Context) override;
+
+	virtual void Update_AnyThread(const FAnimationUpdateContext& Context) override;
+
+	virtual void Evaluate_AnyThread(FPoseContext& Output) override;
+
+	virtual void GatherDebugData(FNodeDebugData& DebugData) override;
+
+private:
+	void RefreshRequest();
+
+	void RefreshBlendWeight(float DeltaTime);
+
+	void EvaluateAnimation(FPoseContext& Output) const;
+
+public:
+	const FName& GetSlotName() const;
+};
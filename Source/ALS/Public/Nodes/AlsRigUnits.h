@@ -22,6 +22,23 @@ public:
 	virtual void Execute() override;
 };
 
+USTRUCT(DisplayName = "Clamp 01 (Array)", Meta = (Category = "ALS"))
+struct ALS_API FAlsRigVMFunction_Clamp01FloatArray : public FRigVMFunction_MathFloatBase
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(Meta = (Input))
+	TArray<float> Values;
+
+	UPROPERTY(Meta = (Output))
+	TArray<float> Results;
+
+public:
+	RIGVM_METHOD()
+	virtual void Execute() override;
+};
+
 USTRUCT(DisplayName = "Exponential Decay (Vector)", Meta = (Category = "ALS"))
 struct ALS_API FAlsRigVMFunction_ExponentialDecayVector : public FRigVMFunction_SimBase
 {
@@ -47,6 +64,32 @@ public:
 	virtual void Execute() override;
 };
 
+// Same as Exponential Decay (Vector), but interpolates all vectors in a single node using SIMD math.
+USTRUCT(DisplayName = "Exponential Decay (Vector Array)", Meta = (Category = "ALS"))
+struct ALS_API FAlsRigVMFunction_ExponentialDecayVectorArray : public FRigVMFunction_SimBase
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(Meta = (Input))
+	TArray<FVector> Targets;
+
+	UPROPERTY(Meta = (Input, ClampMin = 0))
+	float Lambda{1.0f};
+
+	UPROPERTY(Transient, Meta = (Output))
+	TArray<FVector> Current;
+
+	UPROPERTY(Transient)
+	bool bInitialized{false};
+
+public:
+	virtual void Initialize() override;
+
+	RIGVM_METHOD()
+	virtual void Execute() override;
+};
+
 // Calculates the projection location and direction of the perpendicular to AC through B.
 USTRUCT(DisplayName = "Calculate Pole Vector", Meta = (Category = "ALS", NodeColor = "0.05 0.25 0.05"))
 struct ALS_API FAlsRigUnit_CalculatePoleVector : public FRigUnit
@@ -97,6 +140,60 @@ public:
 	virtual void Execute() override;
 };
 
+USTRUCT(BlueprintType)
+struct ALS_API FAlsRigPoleVectorChain
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRigElementKey ItemA;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRigElementKey ItemB;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRigElementKey ItemC;
+};
+
+// Same as Calculate Pole Vector, but processes multiple chains, such as both arms and both legs, in a single node.
+// All output arrays have the same number of elements as the chains array.
+USTRUCT(DisplayName = "Calculate Pole Vectors", Meta = (Category = "ALS", NodeColor = "0.05 0.25 0.05"))
+struct ALS_API FAlsRigUnit_CalculatePoleVectors : public FRigUnit
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(Meta = (Input))
+	TArray<FAlsRigPoleVectorChain> Chains;
+
+	UPROPERTY(Meta = (Input))
+	bool bInitial{false};
+
+	UPROPERTY(Transient, Meta = (Output))
+	TArray<bool> Successes;
+
+	UPROPERTY(Transient, DisplayName = "Item B Locations", Meta = (Output))
+	TArray<FVector> ItemBLocations;
+
+	UPROPERTY(Transient, DisplayName = "Item B Projection Locations", Meta = (Output))
+	TArray<FVector> ItemBProjectionLocations;
+
+	UPROPERTY(Transient, Meta = (Output))
+	TArray<FVector> PoleDirections;
+
+	UPROPERTY(Transient)
+	bool bInitialized{false};
+
+	UPROPERTY(Transient)
+	TArray<FCachedRigElement> CachedItems;
+
+public:
+	virtual void Initialize() override;
+
+	RIGVM_METHOD()
+	virtual void Execute() override;
+};
+
 USTRUCT(DisplayName = "Hand Ik Retargeting", Meta = (Category = "ALS", NodeColor = "0 0.36 1.0"))
 struct ALS_API FAlsRigUnit_HandIkRetargeting : public FRigUnitMutable
 {
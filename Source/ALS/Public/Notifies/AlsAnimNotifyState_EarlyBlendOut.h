@@ -4,6 +4,10 @@
 #include "Utility/AlsGameplayTags.h"
 #include "AlsAnimNotifyState_EarlyBlendOut.generated.h"
 
+class AAlsCharacter;
+
+// Blends out the montage as soon as any of the enabled conditions is met. Instead of checking the conditions every tick,
+// the montage instance is subscribed to AAlsCharacter::OnStateChanged for the duration of the notify state.
 UCLASS(DisplayName = "Als Early Blend Out Animation Notify State")
 class ALS_API UAlsAnimNotifyState_EarlyBlendOut : public UAnimNotifyState
 {
@@ -43,5 +47,13 @@ public:
 	virtual bool CanBePlaced(UAnimSequenceBase* Sequence) const override;
 #endif
 
-	virtual void BranchingPointNotifyTick(FBranchingPointNotifyPayload& NotifyPayload, float DeltaTime) override;
+	virtual void BranchingPointNotifyBegin(FBranchingPointNotifyPayload& NotifyPayload) override;
+
+	virtual void BranchingPointNotifyEnd(FBranchingPointNotifyPayload& NotifyPayload) override;
+
+private:
+	void OnCharacterStateChanged(TWeakObjectPtr<AAlsCharacter> CharacterWeak,
+	                             TWeakObjectPtr<UAnimInstance> AnimationInstanceWeak, int32 MontageInstanceID);
+
+	bool TryBlendOut(const AAlsCharacter& Character, UAnimInstance& AnimationInstance, int32 MontageInstanceID) const;
 };
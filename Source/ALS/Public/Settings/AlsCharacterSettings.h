@@ -43,6 +43,19 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	uint8 bAutoTurnOffSprint : 1{false};
 
+	// How often the view and rotation of characters in crowd mode are refreshed.
+	// See AAlsCharacter::SetCrowdModeEnabled().
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float CrowdModeUpdateInterval{0.1f};
+
+	// Number of samples kept in the locomotion history of the character, see AAlsCharacter::SampleLocomotionHistory().
+	// Should cover the longest time span that has to be rewound, such as the maximum lag compensation time. Zero disables it.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0))
+	int32 LocomotionHistoryCapacity{0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float LocomotionHistoryInterval{1.0f / 30.0f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsViewSettings View;
 
@@ -12,4 +12,14 @@ struct ALS_API FAlsGeneralAnimationSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
 	float LeanInterpolationSpeed{4.0f};
+
+	// If checked, purely cosmetic animation instance work (layering, look and spine rotation, velocity and stride
+	// blending, leaning, ground prediction and feet) is skipped on dedicated servers. Root motion, montages, notifies,
+	// transitions, rotate in place and turn in place are still refreshed, as they affect the character's movement.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bUseDedicatedServerProfile : 1 {false};
+
+	// If checked, feet are still refreshed with the dedicated server profile, for example for server side IK hit validation.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bUseDedicatedServerProfile"))
+	uint8 bRefreshFeetOnDedicatedServer : 1 {false};
 };
@@ -15,6 +15,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "cm/s"))
 	float MaxBodySpeed{5000.0f};
 
+	// Bones captured into the final ragdoll pose used to blend out of the ragdoll. Bones not listed
+	// here keep their evaluated local transforms, which is cheaper. If empty, all bones are captured.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	TArray<FName> SnapshotBones;
+
 	// for correction in multiplayer
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
 	float VelocityInterpolationSpeed{10.0f};
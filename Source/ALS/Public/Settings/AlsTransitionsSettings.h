@@ -9,6 +9,12 @@ struct ALS_API FAlsTransitionsSettings
 {
 	GENERATED_BODY()
 
+	// If checked, transitions are not played as dynamic montages, but are passed through TransitionsState.SlotRequest
+	// to the "ALS Slot Animation" node in the animation graph. This avoids the one frame delay caused by the game
+	// thread montage queue, as well as the montage instance allocation for every transition.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bPlayThroughAnimationGraph : 1 {false};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
 	float QuickStopBlendInDuration{0.1f};
 
@@ -19,6 +19,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
 	uint8 bScalePlayRateByAnimatedTurnAngle : 1 {true};
 
+	// Ignored if the animation has baked Als Animation Metadata, the total root yaw angle from it is used instead.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 0, ClampMax = 180, ForceUnits = "deg"))
 	float AnimatedTurnAngle;
 };
@@ -47,6 +48,11 @@ struct ALS_API FAlsGeneralTurnInPlaceSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	uint8 bDisableFootLock : 1 {false};
 
+	// If checked, turn in place animations are not played as dynamic montages, but are passed
+	// through TurnInPlaceState.SlotRequest to the "ALS Slot Animation" node in the animation graph.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bPlayThroughAnimationGraph : 1 {false};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Instanced, DisplayName = "Standing Turn 90 Left")
 	TObjectPtr<UAlsTurnInPlaceSettings> StandingTurn90Left{nullptr};
 
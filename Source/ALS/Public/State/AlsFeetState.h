@@ -89,3 +89,24 @@ struct ALS_API FAlsFeetState
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FVector2f MinMaxPelvisOffsetZ{ForceInit};
 };
+
+// Values that are the same for all feet. Calculated once per animation update and then shared by all feet, so that
+// the per foot pass only does the work that actually depends on the foot.
+struct ALS_API FAlsFeetRefreshContext
+{
+	FTransform ComponentTransform;
+
+	FTransform ComponentTransformInverse;
+
+	FQuat MovementBaseRotationInverse{ForceInit};
+
+	float DeltaTime{0.0f};
+
+	uint8 bTeleportedRecently : 1 {false};
+
+	uint8 bFootLockInhibited : 1 {false};
+
+	uint8 bGrounded : 1 {false};
+
+	uint8 bInAir : 1 {false};
+};
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "AlsLocomotionHistory.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsLocomotionHistorySample
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "s"))
+	double Time{0.0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector Location{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator Rotation{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator ViewRotation{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float CapsuleHalfHeight{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag LocomotionMode;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Stance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Gait;
+};
+
+// Fixed size ring buffer of quantized locomotion history samples. Locations are stored with millimeter precision
+// and rotations are compressed to 16 bits per axis. Memory is only allocated by Initialize(), so recording and
+// looking up samples doesn't allocate.
+USTRUCT()
+struct ALS_API FAlsLocomotionHistory
+{
+	GENERATED_BODY()
+
+private:
+	struct FEntry
+	{
+		double Time{0.0};
+
+		FIntVector Location{ForceInit};
+
+		uint16 Pitch{0};
+
+		uint16 Yaw{0};
+
+		uint16 Roll{0};
+
+		uint16 ViewPitch{0};
+
+		uint16 ViewYaw{0};
+
+		uint16 CapsuleHalfHeight{0};
+
+		FGameplayTag LocomotionMode;
+
+		FGameplayTag Stance;
+
+		FGameplayTag Gait;
+	};
+
+	TArray<FEntry> Entries;
+
+	// Index of the oldest entry.
+	int32 Head{0};
+
+	int32 Count{0};
+
+public:
+	void Initialize(int32 Capacity);
+
+	void Reset();
+
+	int32 GetCapacity() const;
+
+	int32 Num() const;
+
+	// Samples must be recorded in chronological order. Once the buffer is full, the oldest sample is overwritten.
+	void Record(const FAlsLocomotionHistorySample& Sample);
+
+	// Returns the sample at the given time, interpolated between the two closest recorded samples. Gameplay tags are
+	// taken from the earlier sample. Times after the latest sample return the latest sample. Returns false if the
+	// history is empty or the time is before the earliest sample.
+	bool Sample(double Time, FAlsLocomotionHistorySample& OutSample) const;
+
+private:
+	const FEntry& GetEntry(int32 Index) const;
+
+	static void Decompress(const FEntry& Entry, FAlsLocomotionHistorySample& OutSample);
+};
+
+inline int32 FAlsLocomotionHistory::GetCapacity() const
+{
+	return Entries.Num();
+}
+
+inline int32 FAlsLocomotionHistory::Num() const
+{
+	return Count;
+}
+
+inline const FAlsLocomotionHistory::FEntry& FAlsLocomotionHistory::GetEntry(const int32 Index) const
+{
+	return Entries[(Head + Index) % Entries.Num()];
+}
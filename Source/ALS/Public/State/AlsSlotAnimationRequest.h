@@ -0,0 +1,66 @@
+#pragma once
+
+#include "AlsSlotAnimationRequest.generated.h"
+
+class UAnimSequenceBase;
+
+// Animation request consumed directly by FAlsAnimNode_SlotAnimation in the animation graph. Written by the animation
+// instance during the animation update, so it can be safely read from the worker thread without a game thread round trip.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsSlotAnimationRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TObjectPtr<UAnimSequenceBase> Animation{nullptr};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FName SlotName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float BlendInDuration{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float BlendOutDuration{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "x"))
+	float PlayRate{1.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float StartTime{0.0f};
+
+	// Incremented for each new request, the animation node restarts playback whenever this value changes.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	int32 PlayCounter{0};
+
+	// Incremented for each stop request, the animation node blends out whenever this value changes.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	int32 StopCounter{0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float StopBlendOutDuration{0.0f};
+
+public:
+	void Play(UAnimSequenceBase* NewAnimation, const FName& NewSlotName, float NewBlendInDuration,
+	          float NewBlendOutDuration, float NewPlayRate, float NewStartTime);
+
+	void Stop(float NewBlendOutDuration);
+};
+
+inline void FAlsSlotAnimationRequest::Play(UAnimSequenceBase* NewAnimation, const FName& NewSlotName, const float NewBlendInDuration,
+                                           const float NewBlendOutDuration, const float NewPlayRate, const float NewStartTime)
+{
+	Animation = NewAnimation;
+	SlotName = NewSlotName;
+	BlendInDuration = NewBlendInDuration;
+	BlendOutDuration = NewBlendOutDuration;
+	PlayRate = NewPlayRate;
+	StartTime = NewStartTime;
+	PlayCounter += 1;
+}
+
+inline void FAlsSlotAnimationRequest::Stop(const float NewBlendOutDuration)
+{
+	StopBlendOutDuration = NewBlendOutDuration;
+	StopCounter += 1;
+}
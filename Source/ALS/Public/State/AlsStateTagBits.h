@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Misc/EnumClassFlags.h"
+
+struct FGameplayTagContainer;
+
+// Bit mirror of the built-in ALS state tags. Used by the animation instance for hot checks on the worker thread, so
+// that they become plain bit tests instead of FGameplayTagContainer::HasTag() calls. Project specific tags are not
+// mirrored here and still have to be checked through the gameplay tag container.
+enum class EAlsStateTagBits : uint64
+{
+	None = 0,
+
+	// Locomotion mode.
+
+	Grounded = 1ull << 0,
+	InAir = 1ull << 1,
+
+	// View mode.
+
+	FirstPerson = 1ull << 2,
+	ThirdPerson = 1ull << 3,
+
+	// Rotation mode.
+
+	VelocityDirection = 1ull << 4,
+	ViewDirection = 1ull << 5,
+	Aiming = 1ull << 6,
+
+	// Stance.
+
+	Standing = 1ull << 7,
+	Crouching = 1ull << 8,
+	LyingFront = 1ull << 9,
+	LyingBack = 1ull << 10,
+
+	// Gait.
+
+	Walking = 1ull << 11,
+	Running = 1ull << 12,
+	Sprinting = 1ull << 13,
+
+	// Overlay mode.
+
+	OverlayDefault = 1ull << 14,
+	OverlayMasculine = 1ull << 15,
+	OverlayFeminine = 1ull << 16,
+	OverlayInjured = 1ull << 17,
+	OverlayHandsTied = 1ull << 18,
+	OverlayM4 = 1ull << 19,
+	OverlayPistolOneHanded = 1ull << 20,
+	OverlayPistolTwoHanded = 1ull << 21,
+	OverlayBow = 1ull << 22,
+	OverlayTorch = 1ull << 23,
+	OverlayBinoculars = 1ull << 24,
+	OverlayBox = 1ull << 25,
+	OverlayBarrel = 1ull << 26,
+
+	// State flags.
+
+	LeftShoulder = 1ull << 27,
+	FacingUpward = 1ull << 28,
+	MantleHigh = 1ull << 29,
+	MantleMedium = 1ull << 30,
+	MantleLow = 1ull << 31
+};
+
+ENUM_CLASS_FLAGS(EAlsStateTagBits)
+
+namespace AlsStateTagBits
+{
+	// Same as calling FGameplayTagContainer::HasTag() on the container for each of the mirrored tags.
+	ALS_API EAlsStateTagBits FromGameplayTags(const FGameplayTagContainer& Tags);
+}
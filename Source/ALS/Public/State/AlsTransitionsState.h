@@ -1,5 +1,6 @@
 #pragma once
 
+#include "AlsSlotAnimationRequest.h"
 #include "AlsTransitionsState.generated.h"
 
 class UAnimSequenceBase;
@@ -35,4 +36,8 @@ struct ALS_API FAlsTransitionsState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
 	float QueuedStopTransitionsBlendOutDuration{0.0f};
+
+	// Used instead of the queued animation when transitions are played through the animation graph.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsSlotAnimationRequest SlotRequest;
 };
@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include "AlsSlotAnimationRequest.h"
 #include "AlsTurnInPlaceState.generated.h"
 
 class UAlsTurnInPlaceSettings;
@@ -26,4 +27,8 @@ struct ALS_API FAlsTurnInPlaceState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	uint8 bFootLockInhibited : 1 {false};
+
+	// Used instead of the queued settings when turn in place animations are played through the animation graph.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsSlotAnimationRequest SlotRequest;
 };
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Animation/AnimMetaData.h"
+#include "AlsAnimationMetadata.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsAnimationTimeRange
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ForceUnits = "s"))
+	float StartTime{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ForceUnits = "s"))
+	float EndTime{0.0f};
+};
+
+// Root motion and foot lock data baked by the "Als Bake Animation Metadata" animation modifier, so that
+// runtime systems can query it with a table lookup instead of sampling curves or extracting root motion.
+// Tables are sampled at the animation sampling frame rate, all times are in animation asset time.
+UCLASS(DisplayName = "Als Animation Metadata")
+class ALS_API UAlsAnimationMetadata : public UAnimMetaData
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ForceUnits = "s"))
+	float SampleInterval{0.0f};
+
+	// Root bone yaw angle relative to the first frame, unwound, so it can exceed 180 degrees.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings")
+	TArray<float> CumulativeYawAngles;
+
+	// Root bone Z location relative to the first frame.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings")
+	TArray<float> RootZOffsets;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ForceUnits = "cm"))
+	FVector3f TotalRootTranslation{ForceInit};
+
+	// Time ranges in which the foot lock curve is at full weight.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings")
+	TArray<FAlsAnimationTimeRange> FootLeftLockRanges;
+
+	// Time ranges in which the foot lock curve is at full weight.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings")
+	TArray<FAlsAnimationTimeRange> FootRightLockRanges;
+
+public:
+	bool HasRootYaw() const;
+
+	float GetTotalYawAngle() const;
+
+	float GetCumulativeYawAngle(float Time) const;
+
+	float GetRootZOffset(float Time) const;
+
+	bool IsFootLeftLocked(float Time) const;
+
+	bool IsFootRightLocked(float Time) const;
+
+private:
+	float SampleTable(const TArray<float>& Table, float Time) const;
+
+	static bool IsTimeInRanges(const TArray<FAlsAnimationTimeRange>& Ranges, float Time);
+};
+
+inline bool UAlsAnimationMetadata::HasRootYaw() const
+{
+	return CumulativeYawAngles.Num() > 0;
+}
+
+inline float UAlsAnimationMetadata::GetTotalYawAngle() const
+{
+	return HasRootYaw() ? CumulativeYawAngles.Last() : 0.0f;
+}
+
+inline float UAlsAnimationMetadata::GetCumulativeYawAngle(const float Time) const
+{
+	return SampleTable(CumulativeYawAngles, Time);
+}
+
+inline float UAlsAnimationMetadata::GetRootZOffset(const float Time) const
+{
+	return SampleTable(RootZOffsets, Time);
+}
+
+inline bool UAlsAnimationMetadata::IsFootLeftLocked(const float Time) const
+{
+	return IsTimeInRanges(FootLeftLockRanges, Time);
+}
+
+inline bool UAlsAnimationMetadata::IsFootRightLocked(const float Time) const
+{
+	return IsTimeInRanges(FootRightLockRanges, Time);
+}
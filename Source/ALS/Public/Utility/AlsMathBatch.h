@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Containers/ArrayView.h"
+#include "Math/Vector.h"
+
+struct FAlsSpringFloatState;
+
+// Batch versions of the UAlsMath interpolation functions. Each function processes whole arrays using SIMD registers, four
+// floats at a time or one vector at a time, and produces the same results (up to floating point rounding) as calling
+// the corresponding UAlsMath function for every element.
+// Intended to be used as the inner loop of updates that process multiple values or multiple characters at once.
+// All arrays passed to a single call must have the same number of elements.
+namespace AlsMathBatch
+{
+	// Same as UAlsMath::ExponentialDecay(DeltaTime, Lambda) for each lambda.
+	ALS_API void ExponentialDecayAlpha(TArrayView<float> Alphas, TConstArrayView<float> Lambdas, float DeltaTime);
+
+	// Same as UAlsMath::Damp(DeltaTime, Smoothing) for each smoothing.
+	ALS_API void DampAlpha(TArrayView<float> Alphas, TConstArrayView<float> Smoothings, float DeltaTime);
+
+	ALS_API void ExponentialDecay(TArrayView<float> Values, TConstArrayView<float> Targets,
+	                              TConstArrayView<float> Lambdas, float DeltaTime);
+
+	ALS_API void ExponentialDecay(TArrayView<FVector> Values, TConstArrayView<FVector> Targets,
+	                              TConstArrayView<float> Lambdas, float DeltaTime);
+
+	// Same as the overload above, but with the same lambda for all values.
+	ALS_API void ExponentialDecay(TArrayView<FVector> Values, TConstArrayView<FVector> Targets, float Lambda, float DeltaTime);
+
+	ALS_API void Damp(TArrayView<float> Values, TConstArrayView<float> Targets,
+	                  TConstArrayView<float> Smoothings, float DeltaTime);
+
+	ALS_API void LerpAngle(TArrayView<float> Angles, TConstArrayView<float> From,
+	                       TConstArrayView<float> To, TConstArrayView<float> Alphas);
+
+	ALS_API void ExponentialDecayAngle(TArrayView<float> Angles, TConstArrayView<float> Targets,
+	                                   TConstArrayView<float> Lambdas, float DeltaTime);
+
+	ALS_API void InterpolateAngleConstant(TArrayView<float> Angles, TConstArrayView<float> Targets,
+	                                      TConstArrayView<float> InterpolationSpeeds, float DeltaTime);
+
+	// The spring damper has a branch per damping regime, so this simply runs UAlsMath::SpringDamp()
+	// for each element. It's provided so that batched updates can use the same interface for all functions.
+	ALS_API void SpringDamp(TArrayView<float> Values, TConstArrayView<float> Targets, TArrayView<FAlsSpringFloatState> SpringStates,
+	                        float DeltaTime, float Frequency, float DampingRatio, float TargetVelocityAmount = 1.0f);
+}
@@ -23,7 +23,7 @@ public class ALSEditor : ModuleRules
 
 			PrivateDependencyModuleNames.AddRange(
 			[
-				"BlueprintGraph", "Slate", "SlateCore", "Projects"
+				"AssetRegistry", "BlueprintGraph", "Slate", "SlateCore", "Projects"
 			]);
 		}
 	}
@@ -0,0 +1,199 @@
+#include "AlsAnimationModifierUtility.h"
+
+#include "AnimationModifier.h"
+#include "ScopedTransaction.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/Skeleton.h"
+#include "Animation/AnimData/IAnimationDataController.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "HAL/IConsoleManager.h"
+#include "Logging/MessageLog.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Utility/AlsLog.h"
+#include "Utility/AlsMacros.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationModifierUtility)
+
+#define LOCTEXT_NAMESPACE "AlsAnimationModifierUtility"
+
+namespace AlsAnimationModifierUtility
+{
+	TArray<UAnimSequence*> LoadAnimationSequences(FARFilter& Filter)
+	{
+		Filter.ClassPaths.Add(UAnimSequence::StaticClass()->GetClassPathName());
+		Filter.bRecursiveClasses = true;
+
+		TArray<FAssetData> Assets;
+		IAssetRegistry::GetChecked().GetAssets(Filter, Assets);
+
+		FScopedSlowTask SlowTask{
+			static_cast<float>(Assets.Num()), LOCTEXT("LoadingSequences", "Loading animation sequences...")
+		};
+
+		SlowTask.MakeDialog(true);
+
+		TArray<UAnimSequence*> Sequences;
+		Sequences.Reserve(Assets.Num());
+
+		for (const auto& Asset : Assets)
+		{
+			if (SlowTask.ShouldCancel())
+			{
+				break;
+			}
+
+			SlowTask.EnterProgressFrame(1.0f, FText::FromName(Asset.AssetName));
+
+			auto* Sequence{Cast<UAnimSequence>(Asset.GetAsset())};
+			if (IsValid(Sequence))
+			{
+				Sequences.Add(Sequence);
+			}
+		}
+
+		return Sequences;
+	}
+
+	void ApplyAnimationModifiersFromConsole(const TArray<FString>& Arguments)
+	{
+		if (Arguments.Num() < 2)
+		{
+			UE_LOG(LogAls, Warning, TEXT("Usage: Als.ApplyAnimationModifiers <FolderPath|SkeletonPath> <ModifierClass> [ModifierClass...]"));
+			return;
+		}
+
+		TArray<UAnimationModifier*> Modifiers;
+
+		for (auto i{1}; i < Arguments.Num(); i++)
+		{
+			auto* ModifierClass{
+				Arguments[i].Contains(TEXT("/"))
+					? LoadObject<UClass>(nullptr, *Arguments[i])
+					: FindFirstObject<UClass>(*Arguments[i], EFindFirstObjectOptions::NativeFirst)
+			};
+
+			if (!IsValid(ModifierClass) || !ModifierClass->IsChildOf<UAnimationModifier>() ||
+			    ModifierClass->HasAnyClassFlags(CLASS_Abstract))
+			{
+				UE_LOG(LogAls, Warning, TEXT("%hs: %s is not a valid animation modifier class."), __FUNCTION__, *Arguments[i]);
+				return;
+			}
+
+			// Modifiers are created with their default settings.
+			Modifiers.Add(NewObject<UAnimationModifier>(GetTransientPackage(), ModifierClass));
+		}
+
+		const auto* Skeleton{Arguments[0].Contains(TEXT(".")) ? LoadObject<USkeleton>(nullptr, *Arguments[0]) : nullptr};
+
+		const auto Sequences{
+			IsValid(Skeleton)
+				? UAlsAnimationModifierUtility::LoadAnimationSequencesBySkeleton(Skeleton)
+				: UAlsAnimationModifierUtility::LoadAnimationSequencesInFolder(Arguments[0])
+		};
+
+		UAlsAnimationModifierUtility::ApplyAnimationModifiers(Sequences, Modifiers);
+	}
+
+	FAutoConsoleCommand ApplyAnimationModifiersCommand{
+		TEXT("Als.ApplyAnimationModifiers"),
+		TEXT("Applies animation modifiers to all animation sequences in a folder or of a skeleton. ")
+		TEXT("Arguments: <FolderPath|SkeletonPath> <ModifierClass> [ModifierClass...]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&ApplyAnimationModifiersFromConsole)
+	};
+}
+
+TArray<UAnimSequence*> UAlsAnimationModifierUtility::LoadAnimationSequencesInFolder(const FString& FolderPath, const bool bRecursive)
+{
+	FARFilter Filter;
+	Filter.PackagePaths.Add(*FolderPath);
+	Filter.bRecursivePaths = bRecursive;
+
+	return AlsAnimationModifierUtility::LoadAnimationSequences(Filter);
+}
+
+TArray<UAnimSequence*> UAlsAnimationModifierUtility::LoadAnimationSequencesBySkeleton(const USkeleton* Skeleton)
+{
+	if (!ALS_ENSURE(IsValid(Skeleton)))
+	{
+		return {};
+	}
+
+	FARFilter Filter;
+	Filter.TagsAndValues.Add(TEXT("Skeleton"), FAssetData{Skeleton}.GetExportTextName());
+
+	return AlsAnimationModifierUtility::LoadAnimationSequences(Filter);
+}
+
+int32 UAlsAnimationModifierUtility::ApplyAnimationModifiers(const TArray<UAnimSequence*>& Sequences,
+                                                             const TArray<UAnimationModifier*>& Modifiers)
+{
+	const auto StartTime{FPlatformTime::Seconds()};
+
+	FScopedSlowTask SlowTask{
+		static_cast<float>(Sequences.Num()), LOCTEXT("ApplyingModifiers", "Applying animation modifiers...")
+	};
+
+	SlowTask.MakeDialog(true);
+
+	auto ModifiedSequencesCount{0};
+
+	for (auto* Sequence : Sequences)
+	{
+		if (SlowTask.ShouldCancel())
+		{
+			break;
+		}
+
+		SlowTask.EnterProgressFrame(1.0f, IsValid(Sequence) ? FText::FromName(Sequence->GetFName()) : FText::GetEmpty());
+
+		if (!IsValid(Sequence))
+		{
+			continue;
+		}
+
+		FScopedTransaction Transaction{LOCTEXT("ApplyModifiersTransaction", "Apply Animation Modifiers")};
+
+		Sequence->Modify();
+
+		{
+			// The brackets opened by the modifiers are nested in this one, so the model is only
+			// finalized once all modifiers have been applied to the sequence.
+
+			IAnimationDataController::FScopedBracket Bracket{
+				Sequence->GetController(), LOCTEXT("ApplyModifiersBracket", "Applying Animation Modifiers")
+			};
+
+			// Go through the engine's apply path, so that the modifiers are stored in the sequence's
+			// asset user data along with their revision, and can be reverted or reapplied later.
+
+			for (const auto* Modifier : Modifiers)
+			{
+				if (IsValid(Modifier))
+				{
+					Modifier->ApplyToAnimationSequence(Sequence);
+				}
+			}
+		}
+
+		ModifiedSequencesCount += 1;
+	}
+
+	const auto ElapsedTime{FPlatformTime::Seconds() - StartTime};
+
+	FMessageLog MessageLog{AlsLog::MessageLogName};
+
+	MessageLog.Info(FText::Format(
+		LOCTEXT("ApplyModifiersSummary", "Applied {ModifiersCount} animation modifiers to {ModifiedSequencesCount} of {SequencesCount} animation sequences in {ElapsedTime} seconds."),
+		{
+			{FString{TEXTVIEW("ModifiersCount")}, FText::AsNumber(Modifiers.Num())},
+			{FString{TEXTVIEW("ModifiedSequencesCount")}, FText::AsNumber(ModifiedSequencesCount)},
+			{FString{TEXTVIEW("SequencesCount")}, FText::AsNumber(Sequences.Num())},
+			{FString{TEXTVIEW("ElapsedTime")}, FText::AsNumber(ElapsedTime)}
+		}));
+
+	MessageLog.Open(EMessageSeverity::Info);
+
+	return ModifiedSequencesCount;
+}
+
+#undef LOCTEXT_NAMESPACE
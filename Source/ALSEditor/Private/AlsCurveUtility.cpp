@@ -0,0 +1,131 @@
+#include "AlsCurveUtility.h"
+
+#include "Animation/AnimSequence.h"
+#include "Animation/AnimData/IAnimationDataController.h"
+#include "Animation/AnimData/IAnimationDataModel.h"
+#include "Utility/AlsMacros.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCurveUtility)
+
+namespace AlsCurveUtility
+{
+	bool IsKeyOnSegment(const FRichCurveKey& Key, const FRichCurveKey& SegmentStartKey,
+	                    const FRichCurveKey& SegmentEndKey, const float Tolerance)
+	{
+		const auto SegmentDuration{SegmentEndKey.Time - SegmentStartKey.Time};
+		if (SegmentDuration <= UE_SMALL_NUMBER)
+		{
+			return FMath::IsNearlyEqual(Key.Value, SegmentStartKey.Value, Tolerance) &&
+			       FMath::IsNearlyEqual(Key.Value, SegmentEndKey.Value, Tolerance);
+		}
+
+		const auto Alpha{(Key.Time - SegmentStartKey.Time) / SegmentDuration};
+
+		return FMath::IsNearlyEqual(Key.Value, FMath::Lerp(SegmentStartKey.Value, SegmentEndKey.Value, Alpha), Tolerance);
+	}
+
+	void CompactLinearKeys(const TArray<FRichCurveKey>& Keys, TArray<FRichCurveKey>& CompactedKeys, const float Tolerance)
+	{
+		// Greedily extends each segment for as long as every skipped key stays within the tolerance of the line
+		// between the segment ends. The difference between the original and the compacted curves is piecewise linear
+		// with breakpoints at the original keys, so checking the skipped keys is enough to bound the error everywhere.
+
+		CompactedKeys.Add(Keys[0]);
+
+		auto SegmentStartIndex{0};
+
+		for (auto SegmentEndIndex{2}; SegmentEndIndex < Keys.Num(); SegmentEndIndex++)
+		{
+			for (auto i{SegmentStartIndex + 1}; i < SegmentEndIndex; i++)
+			{
+				if (!IsKeyOnSegment(Keys[i], Keys[SegmentStartIndex], Keys[SegmentEndIndex], Tolerance))
+				{
+					SegmentStartIndex = SegmentEndIndex - 1;
+					CompactedKeys.Add(Keys[SegmentStartIndex]);
+					break;
+				}
+			}
+		}
+
+		CompactedKeys.Add(Keys.Last());
+	}
+
+	void CompactConstantKeys(const TArray<FRichCurveKey>& Keys, TArray<FRichCurveKey>& CompactedKeys, const float Tolerance)
+	{
+		CompactedKeys.Add(Keys[0]);
+
+		for (auto i{1}; i < Keys.Num(); i++)
+		{
+			if (!FMath::IsNearlyEqual(Keys[i].Value, CompactedKeys.Last().Value, Tolerance))
+			{
+				CompactedKeys.Add(Keys[i]);
+			}
+		}
+	}
+}
+
+int32 UAlsCurveUtility::CompactCurve(UAnimSequence* Sequence, const FName& CurveName, const float Tolerance)
+{
+	if (!ALS_ENSURE(IsValid(Sequence)))
+	{
+		return 0;
+	}
+
+	const FAnimationCurveIdentifier CurveId{CurveName, ERawCurveTrackTypes::RCT_Float};
+
+	const auto* Curve{Sequence->GetDataModel()->FindFloatCurve(CurveId)};
+	if (Curve == nullptr)
+	{
+		return 0;
+	}
+
+	const auto& Keys{Curve->FloatCurve.GetConstRefOfKeys()};
+	if (Keys.Num() <= 1)
+	{
+		return 0;
+	}
+
+	const auto InterpolationMode{Keys[0].InterpMode.GetValue()};
+	if (InterpolationMode != RCIM_Linear && InterpolationMode != RCIM_Constant)
+	{
+		return 0;
+	}
+
+	auto bConstantCurve{true};
+
+	for (const auto& Key : Keys)
+	{
+		if (Key.InterpMode != InterpolationMode)
+		{
+			// Mixed interpolation modes are left as is, since removing a key changes the interpolation of its segment.
+			return 0;
+		}
+
+		bConstantCurve &= FMath::IsNearlyEqual(Key.Value, Keys[0].Value, Tolerance);
+	}
+
+	TArray<FRichCurveKey> CompactedKeys;
+	CompactedKeys.Reserve(Keys.Num());
+
+	if (bConstantCurve)
+	{
+		// A curve with a single key evaluates to that key's value at any time, regardless of extrapolation.
+		CompactedKeys.Add(Keys[0]);
+	}
+	else if (InterpolationMode == RCIM_Linear)
+	{
+		AlsCurveUtility::CompactLinearKeys(Keys, CompactedKeys, Tolerance);
+	}
+	else
+	{
+		AlsCurveUtility::CompactConstantKeys(Keys, CompactedKeys, Tolerance);
+	}
+
+	const auto RemovedKeysCount{Keys.Num() - CompactedKeys.Num()};
+	if (RemovedKeysCount > 0)
+	{
+		Sequence->GetController().SetCurveKeys(CurveId, CompactedKeys);
+	}
+
+	return RemovedKeysCount;
+}
@@ -0,0 +1,101 @@
+﻿#include "Modifiers/AlsAnimationModifier_BakeAnimationMetadata.h"
+
+#include "Animation/AnimSequence.h"
+#include "Animation/AnimData/IAnimationDataModel.h"
+#include "Utility/AlsAnimationMetadata.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationModifier_BakeAnimationMetadata)
+
+void UAlsAnimationModifier_BakeAnimationMetadata::OnApply_Implementation(UAnimSequence* Sequence)
+{
+	Super::OnApply_Implementation(Sequence);
+
+	auto* Metadata{Sequence->FindMetaDataByClass<UAlsAnimationMetadata>()};
+	if (!IsValid(Metadata))
+	{
+		Metadata = NewObject<UAlsAnimationMetadata>(Sequence, NAME_None, RF_Transactional);
+		Sequence->AddMetaData(Metadata);
+	}
+
+	Metadata->Modify();
+
+	const auto KeysCount{Sequence->GetNumberOfSampledKeys()};
+
+	Metadata->SampleInterval = KeysCount > 1 ? Sequence->GetTimeAtFrame(1) : 0.0f;
+
+	TArray<FTransform> RootTransforms;
+	Sequence->GetDataModel()->GetBoneTrackTransforms(RootBoneName, RootTransforms);
+
+	// Frames missing from the track are treated as identity, the same as GetBoneTrackTransform() does.
+	RootTransforms.SetNum(FMath::Max(RootTransforms.Num(), KeysCount));
+
+	Metadata->CumulativeYawAngles.Reset(KeysCount);
+	Metadata->RootZOffsets.Reset(KeysCount);
+	Metadata->TotalRootTranslation = FVector3f::ZeroVector;
+
+	if (KeysCount > 0)
+	{
+		auto CumulativeYawAngle{0.0};
+		auto PreviousYawAngle{RootTransforms[0].Rotator().Yaw};
+
+		for (auto i{0}; i < KeysCount; i++)
+		{
+			const auto YawAngle{RootTransforms[i].Rotator().Yaw};
+
+			CumulativeYawAngle += FRotator3d::NormalizeAxis(YawAngle - PreviousYawAngle);
+			PreviousYawAngle = YawAngle;
+
+			Metadata->CumulativeYawAngles.Add(UE_REAL_TO_FLOAT(CumulativeYawAngle));
+			Metadata->RootZOffsets.Add(UE_REAL_TO_FLOAT(RootTransforms[i].GetLocation().Z - RootTransforms[0].GetLocation().Z));
+		}
+
+		Metadata->TotalRootTranslation = FVector3f{RootTransforms[KeysCount - 1].GetLocation() - RootTransforms[0].GetLocation()};
+	}
+
+	BakeFullWeightRanges(Sequence, FootLeftLockCurveName, Metadata->FootLeftLockRanges);
+	BakeFullWeightRanges(Sequence, FootRightLockCurveName, Metadata->FootRightLockRanges);
+}
+
+void UAlsAnimationModifier_BakeAnimationMetadata::OnRevert_Implementation(UAnimSequence* Sequence)
+{
+	Super::OnRevert_Implementation(Sequence);
+
+	auto* Metadata{Sequence->FindMetaDataByClass<UAlsAnimationMetadata>()};
+	if (IsValid(Metadata))
+	{
+		Sequence->RemoveMetaData(Metadata);
+	}
+}
+
+void UAlsAnimationModifier_BakeAnimationMetadata::BakeFullWeightRanges(const UAnimSequence* Sequence, const FName& CurveName,
+                                                                        TArray<FAlsAnimationTimeRange>& Ranges)
+{
+	Ranges.Reset();
+
+	const auto* Curve{Sequence->GetDataModel()->FindFloatCurve({CurveName, ERawCurveTrackTypes::RCT_Float})};
+	if (Curve == nullptr)
+	{
+		return;
+	}
+
+	// Uses the same full weight check as the foot lock in the animation instance.
+
+	auto bInRange{false};
+
+	for (auto i{0}; i < Sequence->GetNumberOfSampledKeys(); i++)
+	{
+		const auto Time{Sequence->GetTimeAtFrame(i)};
+		const auto bFullWeight{FAnimWeight::IsFullWeight(Curve->FloatCurve.Eval(Time))};
+
+		if (bFullWeight && !bInRange)
+		{
+			Ranges.Add({Time, Time});
+		}
+		else if (bFullWeight)
+		{
+			Ranges.Last().EndTime = Time;
+		}
+
+		bInRange = bFullWeight;
+	}
+}
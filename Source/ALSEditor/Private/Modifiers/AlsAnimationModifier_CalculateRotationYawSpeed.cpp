@@ -1,6 +1,8 @@
 ﻿#include "Modifiers/AlsAnimationModifier_CalculateRotationYawSpeed.h"
 
 #include "Animation/AnimSequence.h"
+#include "Animation/AnimData/IAnimationDataController.h"
+#include "Animation/AnimData/IAnimationDataModel.h"
 #include "Utility/AlsConstants.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationModifier_CalculateRotationYawSpeed)
@@ -16,24 +18,45 @@ void UAlsAnimationModifier_CalculateRotationYawSpeed::OnApply_Implementation(UAn
 
 	UAnimationBlueprintLibrary::AddCurve(Sequence, UAlsConstants::RotationYawSpeedCurveName());
 
-	const auto* DataModel{Sequence->GetDataModel()};
+	const auto KeysCount{Sequence->GetNumberOfSampledKeys()};
+	if (KeysCount <= 0)
+	{
+		return;
+	}
+
+	// Read the whole root bone track at once and submit all keys in a single controller
+	// call, instead of going through the data model and the controller for each frame.
+
+	TArray<FTransform> RootTransforms;
+	Sequence->GetDataModel()->GetBoneTrackTransforms(UAlsConstants::RootBoneName(), RootTransforms);
+
+	// Frames missing from the track are treated as identity, the same as GetBoneTrackTransform() does.
+	RootTransforms.SetNum(FMath::Max(RootTransforms.Num(), KeysCount));
+
+	TArray<double> RootYawAngles;
+	RootYawAngles.SetNumUninitialized(KeysCount);
+
+	for (auto i{0}; i < KeysCount; i++)
+	{
+		RootYawAngles[i] = RootTransforms[i].Rotator().Yaw;
+	}
+
 	const auto FrameRate{Sequence->GetSamplingFrameRate().AsDecimal()};
+	const auto bForwardPlayback{Sequence->RateScale >= 0.0f};
 
-	UAnimationBlueprintLibrary::AddFloatCurveKey(Sequence, UAlsConstants::RotationYawSpeedCurveName(), 0.0f, 0.0f);
+	TArray<FRichCurveKey> CurveKeys;
+	CurveKeys.Reserve(KeysCount);
 
-	for (auto i{1}; i < Sequence->GetNumberOfSampledKeys(); i++)
+	CurveKeys.Emplace(0.0f, 0.0f);
+
+	for (auto i{1}; i < KeysCount; i++)
 	{
-		auto CurrentPoseTransform{
-			DataModel->GetBoneTrackTransform(UAlsConstants::RootBoneName(), i + (Sequence->RateScale >= 0.0f ? -1 : 0))
-		};
-
-		auto NextPoseTransform{
-			DataModel->GetBoneTrackTransform(UAlsConstants::RootBoneName(), i + (Sequence->RateScale >= 0.0f ? 0 : -1))
-		};
-
-		UAnimationBlueprintLibrary::AddFloatCurveKey(Sequence, UAlsConstants::RotationYawSpeedCurveName(), Sequence->GetTimeAtFrame(i),
-		                                             UE_REAL_TO_FLOAT(
-			                                             (NextPoseTransform.Rotator().Yaw - CurrentPoseTransform.Rotator().Yaw) *
-			                                             FMath::Abs(Sequence->RateScale) * FrameRate));
+		const auto CurrentYawAngle{RootYawAngles[bForwardPlayback ? i - 1 : i]};
+		const auto NextYawAngle{RootYawAngles[bForwardPlayback ? i : i - 1]};
+
+		CurveKeys.Emplace(Sequence->GetTimeAtFrame(i),
+		                  UE_REAL_TO_FLOAT((NextYawAngle - CurrentYawAngle) * FMath::Abs(Sequence->RateScale) * FrameRate));
 	}
+
+	Sequence->GetController().SetCurveKeys({UAlsConstants::RotationYawSpeedCurveName(), ERawCurveTrackTypes::RCT_Float}, CurveKeys);
 }
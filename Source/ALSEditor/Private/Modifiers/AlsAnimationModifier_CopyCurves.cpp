@@ -1,5 +1,6 @@
 ﻿#include "Modifiers/AlsAnimationModifier_CopyCurves.h"
 
+#include "AlsCurveUtility.h"
 #include "Animation/AnimSequence.h"
 #include "Utility/AlsMacros.h"
 
@@ -19,7 +20,7 @@ void UAlsAnimationModifier_CopyCurves::OnApply_Implementation(UAnimSequence* Seq
 	{
 		for (const auto& Curve : SourceSequenceObject->GetCurveData().FloatCurves)
 		{
-			CopyCurve(SourceSequenceObject, Sequence, Curve.GetName());
+			CopyCurve(SourceSequenceObject, Sequence, Curve.GetName(), bCompactCurves);
 		}
 	}
 	else
@@ -28,13 +29,14 @@ void UAlsAnimationModifier_CopyCurves::OnApply_Implementation(UAnimSequence* Seq
 		{
 			if (UAnimationBlueprintLibrary::DoesCurveExist(SourceSequenceObject, CurveName, ERawCurveTrackTypes::RCT_Float))
 			{
-				CopyCurve(SourceSequenceObject, Sequence, CurveName);
+				CopyCurve(SourceSequenceObject, Sequence, CurveName, bCompactCurves);
 			}
 		}
 	}
 }
 
-void UAlsAnimationModifier_CopyCurves::CopyCurve(UAnimSequence* SourceSequence, UAnimSequence* TargetSequence, const FName& CurveName)
+void UAlsAnimationModifier_CopyCurves::CopyCurve(UAnimSequence* SourceSequence, UAnimSequence* TargetSequence,
+                                                const FName& CurveName, const bool bCompact)
 {
 	if (UAnimationBlueprintLibrary::DoesCurveExist(TargetSequence, CurveName, ERawCurveTrackTypes::RCT_Float))
 	{
@@ -48,4 +50,9 @@ void UAlsAnimationModifier_CopyCurves::CopyCurve(UAnimSequence* SourceSequence,
 
 	UAnimationBlueprintLibrary::GetFloatKeys(SourceSequence, CurveName, CurveTimes, CurveValues);
 	UAnimationBlueprintLibrary::AddFloatCurveKeys(TargetSequence, CurveName, CurveTimes, CurveValues);
+
+	if (bCompact)
+	{
+		UAlsCurveUtility::CompactCurve(TargetSequence, CurveName);
+	}
 }
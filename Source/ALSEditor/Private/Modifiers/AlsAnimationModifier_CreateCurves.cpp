@@ -1,5 +1,6 @@
 ﻿#include "Modifiers/AlsAnimationModifier_CreateCurves.h"
 
+#include "AlsCurveUtility.h"
 #include "Animation/AnimSequence.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationModifier_CreateCurves)
@@ -37,5 +38,10 @@ void UAlsAnimationModifier_CreateCurves::OnApply_Implementation(UAnimSequence* S
 				                                             CurveKey.Value);
 			}
 		}
+
+		if (bCompactCurves)
+		{
+			UAlsCurveUtility::CompactCurve(Sequence, Curve.Name);
+		}
 	}
 }
@@ -1,5 +1,6 @@
 ﻿#include "Modifiers/AlsAnimationModifier_CreateLayeringCurves.h"
 
+#include "AlsCurveUtility.h"
 #include "Animation/AnimSequence.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationModifier_CreateLayeringCurves)
@@ -44,5 +45,10 @@ void UAlsAnimationModifier_CreateLayeringCurves::CreateCurves(UAnimSequence* Seq
 		{
 			UAnimationBlueprintLibrary::AddFloatCurveKey(Sequence, CurveName, Sequence->GetTimeAtFrame(0), Value);
 		}
+
+		if (bCompactCurves)
+		{
+			UAlsCurveUtility::CompactCurve(Sequence, CurveName);
+		}
 	}
 }
@@ -0,0 +1,44 @@
+﻿#include "Modifiers/AlsAnimationModifier_OptimizeCurves.h"
+
+#include "AlsCurveUtility.h"
+#include "Animation/AnimSequence.h"
+#include "Utility/AlsLog.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationModifier_OptimizeCurves)
+
+void UAlsAnimationModifier_OptimizeCurves::OnApply_Implementation(UAnimSequence* Sequence)
+{
+	Super::OnApply_Implementation(Sequence);
+
+	TArray<FName> OptimizedCurveNames;
+
+	if (bOptimizeAllCurves)
+	{
+		// Curve names are gathered first since compaction modifies the curves array.
+
+		for (const auto& Curve : Sequence->GetCurveData().FloatCurves)
+		{
+			OptimizedCurveNames.Add(Curve.GetName());
+		}
+	}
+	else
+	{
+		OptimizedCurveNames = CurveNames;
+	}
+
+	auto RemovedKeysCount{0};
+	auto OptimizedCurvesCount{0};
+
+	for (const auto& CurveName : OptimizedCurveNames)
+	{
+		const auto CurveRemovedKeysCount{UAlsCurveUtility::CompactCurve(Sequence, CurveName, Tolerance)};
+		if (CurveRemovedKeysCount > 0)
+		{
+			RemovedKeysCount += CurveRemovedKeysCount;
+			OptimizedCurvesCount += 1;
+		}
+	}
+
+	UE_LOG(LogAls, Log, TEXT("%hs: Optimized %d curves of %s, removed %d keys, saved %d bytes."), __FUNCTION__,
+	       OptimizedCurvesCount, *Sequence->GetName(), RemovedKeysCount, RemovedKeysCount * static_cast<int32>(sizeof(FRichCurveKey)));
+}
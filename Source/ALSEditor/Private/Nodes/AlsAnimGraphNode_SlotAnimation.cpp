@@ -0,0 +1,29 @@
+#include "Nodes/AlsAnimGraphNode_SlotAnimation.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimGraphNode_SlotAnimation)
+
+#define LOCTEXT_NAMESPACE "AlsAnimGraphNode_SlotAnimation"
+
+FText UAlsAnimGraphNode_SlotAnimation::GetNodeTitle(const ENodeTitleType::Type TitleType) const
+{
+	if (TitleType == ENodeTitleType::ListView || TitleType == ENodeTitleType::MenuTitle || Node.SlotName.IsNone())
+	{
+		return LOCTEXT("Title", "ALS Slot Animation");
+	}
+
+	static const FTextFormat TitleFormat{LOCTEXT("SlotTitle", "ALS Slot Animation '{SlotName}'")};
+
+	return FText::Format(TitleFormat, {{FString{TEXTVIEW("SlotName")}, FText::FromName(Node.SlotName)}});
+}
+
+FText UAlsAnimGraphNode_SlotAnimation::GetTooltipText() const
+{
+	return LOCTEXT("Tooltip", "Plays animations requested through the ALS slot animation request without using montages");
+}
+
+FString UAlsAnimGraphNode_SlotAnimation::GetNodeCategory() const
+{
+	return FString{TEXTVIEW("ALS")};
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "AlsAnimationModifierUtility.generated.h"
+
+class UAnimationModifier;
+class UAnimSequence;
+class USkeleton;
+
+UCLASS()
+class ALSEDITOR_API UAlsAnimationModifierUtility : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "ALS|Animation Modifier Utility")
+	static TArray<UAnimSequence*> LoadAnimationSequencesInFolder(const FString& FolderPath, bool bRecursive = true);
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|Animation Modifier Utility")
+	static TArray<UAnimSequence*> LoadAnimationSequencesBySkeleton(const USkeleton* Skeleton);
+
+	// Applies all modifiers to each sequence with a progress dialog, the same way as the animation modifiers editor does, so
+	// they can be reverted or reapplied later. Each sequence is processed in one transaction and one animation data controller
+	// bracket, so model change notifications and compression happen once per sequence rather than once per modifier.
+	// Returns the number of modified sequences.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Animation Modifier Utility")
+	static int32 ApplyAnimationModifiers(const TArray<UAnimSequence*>& Sequences, const TArray<UAnimationModifier*>& Modifiers);
+};
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "AlsCurveUtility.generated.h"
+
+class UAnimSequence;
+
+UCLASS()
+class ALSEDITOR_API UAlsCurveUtility : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// Removes float curve keys that can be reconstructed from their neighbors, i.e. keys inside constant or
+	// linear segments, so that the curve evaluates to the same values within the given tolerance. A curve whose
+	// keys all have the same value is collapsed to a single key. Only curves whose keys all use linear
+	// or all use constant interpolation are compacted. Returns the number of removed keys.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Curve Utility", Meta = (AutoCreateRefTerm = "CurveName"))
+	static int32 CompactCurve(UAnimSequence* Sequence, const FName& CurveName, float Tolerance = 0.0001f);
+};
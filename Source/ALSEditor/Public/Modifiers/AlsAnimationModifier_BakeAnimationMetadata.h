@@ -0,0 +1,32 @@
+﻿#pragma once
+
+#include "AnimationModifier.h"
+#include "Utility/AlsConstants.h"
+#include "AlsAnimationModifier_BakeAnimationMetadata.generated.h"
+
+struct FAlsAnimationTimeRange;
+
+// Bakes root motion and foot lock data into Als Animation Metadata stored on the animation sequence.
+UCLASS(DisplayName = "Als Bake Animation Metadata Animation Modifier")
+class ALSEDITOR_API UAlsAnimationModifier_BakeAnimationMetadata : public UAnimationModifier
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FName RootBoneName{UAlsConstants::RootBoneName()};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FName FootLeftLockCurveName{UAlsConstants::FootLeftLockCurveName()};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FName FootRightLockCurveName{UAlsConstants::FootRightLockCurveName()};
+
+public:
+	virtual void OnApply_Implementation(UAnimSequence* Sequence) override;
+
+	virtual void OnRevert_Implementation(UAnimSequence* Sequence) override;
+
+private:
+	static void BakeFullWeightRanges(const UAnimSequence* Sequence, const FName& CurveName, TArray<FAlsAnimationTimeRange>& Ranges);
+};
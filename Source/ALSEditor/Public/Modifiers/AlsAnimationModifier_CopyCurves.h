@@ -18,9 +18,13 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (EditCondition = "!bCopyAllCurves"))
 	TArray<FName> CurveNames;
 
+	// Removes redundant keys from the copied curves, e.g. a constant curve is reduced to a single key.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	uint8 bCompactCurves : 1 {false};
+
 public:
 	virtual void OnApply_Implementation(UAnimSequence* Sequence) override;
 
 private:
-	static void CopyCurve(UAnimSequence* SourceSequence, UAnimSequence* TargetSequence, const FName& CurveName);
+	static void CopyCurve(UAnimSequence* SourceSequence, UAnimSequence* TargetSequence, const FName& CurveName, bool bCompact);
 };
@@ -16,6 +16,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	uint8 bAddKeyOnEachFrame : 1 {false};
 
+	// Removes redundant keys from the created curves, e.g. a constant curve is reduced to a single key.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	uint8 bCompactCurves : 1 {false};
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	float CurveValue{0.0f};
 
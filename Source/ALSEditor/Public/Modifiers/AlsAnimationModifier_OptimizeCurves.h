@@ -0,0 +1,25 @@
+﻿#pragma once
+
+#include "AnimationModifier.h"
+#include "AlsAnimationModifier_OptimizeCurves.generated.h"
+
+// Removes float curve keys that lie on constant or linear segments and logs how much curve data was saved.
+UCLASS(DisplayName = "Als Optimize Curves Animation Modifier")
+class ALSEDITOR_API UAlsAnimationModifier_OptimizeCurves : public UAnimationModifier
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	uint8 bOptimizeAllCurves : 1 {true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (EditCondition = "!bOptimizeAllCurves"))
+	TArray<FName> CurveNames;
+
+	// Maximum allowed difference between the original and the optimized curve values.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0))
+	float Tolerance{0.0001f};
+
+public:
+	virtual void OnApply_Implementation(UAnimSequence* Sequence) override;
+};
@@ -1,5 +1,7 @@
 #include "AlsAIController.h"
 
+#include "AlsCharacter.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAIController)
 
 AAlsAIController::AAlsAIController(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
@@ -11,9 +13,22 @@ void AAlsAIController::OnPossess(APawn* NewPawn)
 {
 	Super::OnPossess(NewPawn);
 
+	RefreshCrowdMode();
+
 	RunBehaviorTree(BehaviorTree);
 }
 
+void AAlsAIController::OnUnPossess()
+{
+	auto* Character{Cast<AAlsCharacter>(GetPawn())};
+	if (IsValid(Character))
+	{
+		Character->SetCrowdModeEnabled(false);
+	}
+
+	Super::OnUnPossess();
+}
+
 FVector AAlsAIController::GetFocalPointOnActor(const AActor* Actor) const
 {
 	const auto* FocusedPawn{Cast<APawn>(Actor)};
@@ -24,3 +39,22 @@ FVector AAlsAIController::GetFocalPointOnActor(const AActor* Actor) const
 
 	return Super::GetFocalPointOnActor(Actor);
 }
+
+void AAlsAIController::SetCrowdMode(const bool bNewCrowdMode)
+{
+	if (bCrowdMode != bNewCrowdMode)
+	{
+		bCrowdMode = bNewCrowdMode;
+
+		RefreshCrowdMode();
+	}
+}
+
+void AAlsAIController::RefreshCrowdMode() const
+{
+	auto* Character{Cast<AAlsCharacter>(GetPawn())};
+	if (IsValid(Character))
+	{
+		Character->SetCrowdModeEnabled(bCrowdMode);
+	}
+}
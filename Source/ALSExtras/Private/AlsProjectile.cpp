@@ -9,8 +9,9 @@
 // Sets default values
 AAlsProjectile::AAlsProjectile(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
+	// The projectile has nothing to do every frame, it's moved by its projectile movement
+	// component, or by UAlsProjectileSubsystem when fired through it.
+	PrimaryActorTick.bCanEverTick = false;
 
 	if(!RootComponent)
     {
@@ -41,20 +42,6 @@ AAlsProjectile::AAlsProjectile(const FObjectInitializer& ObjectInitializer) : Su
     }
 }
 
-// Called when the game starts or when spawned
-void AAlsProjectile::BeginPlay()
-{
-	Super::BeginPlay();
-	
-}
-
-// Called every frame
-void AAlsProjectile::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-}
-
 // 発射物の発射方向の速度を初期化する関数。
 void AAlsProjectile::FireInDirection(const FVector& ShootDirection)
 {
@@ -0,0 +1,301 @@
+#include "AlsProjectileSubsystem.h"
+
+#include "AlsProjectile.h"
+#include "Engine/World.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsProjectileSubsystem)
+
+namespace AlsProjectileSubsystem
+{
+	// Distance the projectile is moved away from the hit surface, so that the next sweep doesn't start
+	// penetrating it. Similar to the pull back distance used by UMovementComponent::SafeMoveUpdatedComponent().
+	static constexpr auto PullBackDistance{0.1f};
+}
+
+void UAlsProjectileSubsystem::Deinitialize()
+{
+	Simulations.Reset();
+	Pools.Reset();
+	PendingHitEvents.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UAlsProjectileSubsystem::IsTickable() const
+{
+	return !Simulations.IsEmpty();
+}
+
+TStatId UAlsProjectileSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAlsProjectileSubsystem, STATGROUP_Tickables);
+}
+
+void UAlsProjectileSubsystem::Tick(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsProjectileSubsystem::Tick()"), STAT_UAlsProjectileSubsystem_Tick, STATGROUP_Als)
+
+	Super::Tick(DeltaTime);
+
+	const auto GravityZ{GetWorld()->GetGravityZ()};
+
+	PendingHitEvents.Reset();
+
+	for (auto Index{Simulations.Num() - 1}; Index >= 0; Index--)
+	{
+		auto& Simulation{Simulations[Index]};
+
+		if (!IsValid(Simulation.Projectile))
+		{
+			Simulations.RemoveAtSwap(Index, EAllowShrinking::No);
+			continue;
+		}
+
+		Simulation.RemainingLifeSpan -= DeltaTime;
+
+		if (Simulation.RemainingLifeSpan <= 0.0f)
+		{
+			DeactivateProjectile(Simulation.Projectile);
+			Simulations.RemoveAtSwap(Index, EAllowShrinking::No);
+			continue;
+		}
+
+		if (StepSimulation(Simulation, DeltaTime, GravityZ))
+		{
+			Simulations.RemoveAtSwap(Index, EAllowShrinking::No);
+		}
+	}
+
+	for (const auto& HitEvent : PendingHitEvents)
+	{
+		// The projectile may have been destroyed by the handler of one of the previous events.
+
+		if (!IsValid(HitEvent.Projectile))
+		{
+			continue;
+		}
+
+		auto* ProjectileMovement{HitEvent.Projectile->GetProjectileMovement()};
+
+		if (HitEvent.bStopped)
+		{
+			ProjectileMovement->OnProjectileStop.Broadcast(HitEvent.Hit);
+
+			DeactivateProjectile(HitEvent.Projectile);
+		}
+		else
+		{
+			ProjectileMovement->OnProjectileBounce.Broadcast(HitEvent.Hit, HitEvent.Velocity);
+		}
+	}
+
+	PendingHitEvents.Reset();
+}
+
+AAlsProjectile* UAlsProjectileSubsystem::FireProjectile(const TSubclassOf<AAlsProjectile> ProjectileClass, const FVector& Location,
+                                                        const FVector& Direction, AActor* Owner, APawn* Instigator)
+{
+	if (!IsValid(ProjectileClass))
+	{
+		return nullptr;
+	}
+
+	const auto FireDirection{Direction.GetSafeNormal()};
+
+	auto* Projectile{AcquireProjectile(ProjectileClass, {FireDirection.ToOrientationQuat(), Location}, Owner, Instigator)};
+	if (!IsValid(Projectile))
+	{
+		return nullptr;
+	}
+
+	auto* ProjectileMovement{Projectile->GetProjectileMovement()};
+
+	// The projectile movement component isn't ticked, the projectile is stepped by this subsystem instead.
+
+	ProjectileMovement->SetComponentTickEnabled(false);
+	ProjectileMovement->Velocity = FireDirection * ProjectileMovement->InitialSpeed;
+
+	auto& Simulation{Simulations.Emplace_GetRef()};
+	Simulation.Projectile = Projectile;
+	Simulation.Location = Location;
+	Simulation.Velocity = ProjectileMovement->Velocity;
+	Simulation.RemainingLifeSpan = Projectile->GetSimulationLifeSpan();
+
+	return Projectile;
+}
+
+void UAlsProjectileSubsystem::ReleaseProjectile(AAlsProjectile* Projectile)
+{
+	const auto Index{
+		Simulations.IndexOfByPredicate([Projectile](const FAlsProjectileSimulation& Simulation)
+		{
+			return Simulation.Projectile == Projectile;
+		})
+	};
+
+	if (Index != INDEX_NONE)
+	{
+		Simulations.RemoveAtSwap(Index, EAllowShrinking::No);
+
+		DeactivateProjectile(Projectile);
+	}
+}
+
+AAlsProjectile* UAlsProjectileSubsystem::AcquireProjectile(const TSubclassOf<AAlsProjectile> ProjectileClass, const FTransform& Transform,
+                                                           AActor* Owner, APawn* Instigator)
+{
+	auto* Pool{Pools.Find(ProjectileClass)};
+
+	while (Pool != nullptr && !Pool->Projectiles.IsEmpty())
+	{
+		auto* Projectile{Pool->Projectiles.Pop(EAllowShrinking::No).Get()};
+		if (!IsValid(Projectile))
+		{
+			continue;
+		}
+
+		Projectile->SetOwner(Owner);
+		Projectile->SetInstigator(Instigator);
+		Projectile->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+		Projectile->SetActorHiddenInGame(false);
+		Projectile->SetActorEnableCollision(true);
+
+		return Projectile;
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.Owner = Owner;
+	SpawnParameters.Instigator = Instigator;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	return GetWorld()->SpawnActor<AAlsProjectile>(ProjectileClass, Transform, SpawnParameters);
+}
+
+void UAlsProjectileSubsystem::DeactivateProjectile(AAlsProjectile* Projectile)
+{
+	Projectile->SetActorHiddenInGame(true);
+	Projectile->SetActorEnableCollision(false);
+	Projectile->GetProjectileMovement()->Velocity = FVector::ZeroVector;
+
+	Pools.FindOrAdd(Projectile->GetClass()).Projectiles.Add(Projectile);
+}
+
+bool UAlsProjectileSubsystem::StepSimulation(FAlsProjectileSimulation& Simulation, const float DeltaTime, const float GravityZ)
+{
+	auto* Projectile{Simulation.Projectile.Get()};
+	auto* ProjectileMovement{Projectile->GetProjectileMovement()};
+	const auto* Collision{Projectile->GetCollisionComponent()};
+
+	FCollisionQueryParams QueryParameters{SCENE_QUERY_STAT(AlsProjectileSubsystem_StepSimulation), false, Projectile};
+	FCollisionResponseParams ResponseParameters;
+
+	Collision->InitSweepCollisionParams(QueryParameters, ResponseParameters);
+
+	for (const auto& IgnoredActor : Collision->GetMoveIgnoreActors())
+	{
+		QueryParameters.AddIgnoredActor(IgnoredActor);
+	}
+
+	const auto MaxSpeed{ProjectileMovement->GetMaxSpeed()};
+	const auto MaxIterations{FMath::Max(1, ProjectileMovement->MaxSimulationIterations)};
+
+	auto RemainingTime{DeltaTime};
+	auto Iterations{0};
+	auto bStopped{false};
+
+	// Based on UProjectileMovementComponent::TickComponent(), the time remaining after an impact is spent moving
+	// in the new direction, up to the maximum number of simulation iterations of the projectile movement component.
+
+	while (RemainingTime > UE_KINDA_SMALL_NUMBER && Iterations < MaxIterations && !bStopped)
+	{
+		Iterations += 1;
+
+		const auto TimeStep{RemainingTime};
+		RemainingTime = 0.0f;
+
+		// Based on UProjectileMovementComponent::ComputeMoveDelta(), with the velocity integrated using the trapezoidal rule.
+
+		auto NewVelocity{Simulation.Velocity};
+		NewVelocity.Z += GravityZ * ProjectileMovement->ProjectileGravityScale * TimeStep;
+
+		if (MaxSpeed > 0.0f)
+		{
+			NewVelocity = NewVelocity.GetClampedToMaxSize(MaxSpeed);
+		}
+
+		const auto StartLocation{Simulation.Location};
+		const auto EndLocation{StartLocation + (Simulation.Velocity + NewVelocity) * (0.5f * TimeStep)};
+
+		FHitResult Hit;
+
+		const auto bHit{
+			GetWorld()->SweepSingleByChannel(Hit, StartLocation, EndLocation, Collision->GetComponentQuat(),
+			                                 Collision->GetCollisionObjectType(), Collision->GetCollisionShape(),
+			                                 QueryParameters, ResponseParameters)
+		};
+
+		if (!bHit)
+		{
+			Simulation.Location = EndLocation;
+			Simulation.Velocity = NewVelocity;
+			continue;
+		}
+
+		if (Hit.bStartPenetrating)
+		{
+			// The projectile started inside of something, so there is no impact to bounce off. Push it out
+			// and try the same move again, similar to UMovementComponent::ResolvePenetration().
+
+			Simulation.Location += Hit.Normal * (Hit.PenetrationDepth + AlsProjectileSubsystem::PullBackDistance);
+			RemainingTime = TimeStep;
+			continue;
+		}
+
+		// Move to the impact location and spend the rest of the time step after the impact.
+
+		const auto ImpactTime{TimeStep * Hit.Time};
+		RemainingTime = TimeStep - ImpactTime;
+
+		Simulation.Location = Hit.Location + Hit.Normal * AlsProjectileSubsystem::PullBackDistance;
+		Simulation.Velocity = FMath::Lerp(Simulation.Velocity, NewVelocity, Hit.Time);
+
+		const auto ImpactVelocity{Simulation.Velocity};
+
+		if (ProjectileMovement->bShouldBounce)
+		{
+			// Based on UProjectileMovementComponent::ComputeBounceVelocity().
+
+			const auto NormalVelocity{Hit.Normal * (Simulation.Velocity | Hit.Normal)};
+
+			Simulation.Velocity = (Simulation.Velocity - NormalVelocity) * (1.0f - FMath::Clamp(ProjectileMovement->Friction, 0.0f, 1.0f)) -
+			                      NormalVelocity * ProjectileMovement->Bounciness;
+
+			bStopped = Simulation.Velocity.SizeSquared() < FMath::Square(ProjectileMovement->BounceVelocityStopSimulatingThreshold);
+		}
+		else
+		{
+			bStopped = true;
+		}
+
+		if (bStopped)
+		{
+			Simulation.Velocity = FVector::ZeroVector;
+		}
+
+		PendingHitEvents.Add({Projectile, Hit, ImpactVelocity, bStopped});
+	}
+
+	ProjectileMovement->Velocity = Simulation.Velocity;
+
+	const auto NewRotation{
+		ProjectileMovement->bRotationFollowsVelocity && !Simulation.Velocity.IsNearlyZero()
+			? Simulation.Velocity.ToOrientationQuat()
+			: Projectile->GetActorQuat()
+	};
+
+	Projectile->SetActorLocationAndRotation(Simulation.Location, NewRotation, false, nullptr, ETeleportType::TeleportPhysics);
+
+	return bStopped;
+}
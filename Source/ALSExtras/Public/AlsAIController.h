@@ -12,9 +12,22 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AlsAIController|Settings")
 	TObjectPtr<UBehaviorTree> BehaviorTree;
 
+	// If checked, the possessed character runs in crowd mode, see AAlsCharacter::SetCrowdModeEnabled().
+	// Intended for ambient characters that don't need the full player grade locomotion update.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AlsAIController|Settings")
+	uint8 bCrowdMode : 1 {false};
+
 protected:
 	virtual void OnPossess(APawn* NewPawn) override;
 
+	virtual void OnUnPossess() override;
+
 public:
 	virtual FVector GetFocalPointOnActor(const AActor* Actor) const override;
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|AI Controller")
+	void SetCrowdMode(bool bNewCrowdMode);
+
+private:
+	void RefreshCrowdMode() const;
 };
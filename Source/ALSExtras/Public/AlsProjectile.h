@@ -20,15 +20,33 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Movement)
 	TObjectPtr<UProjectileMovementComponent> ProjectileMovementComponent;
 
-protected:
-	// Called when the game starts or when spawned
-	virtual void BeginPlay() override;
-
-public:	
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
+	// Time after which a projectile fired through UAlsProjectileSubsystem is returned to the pool if it hasn't stopped.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Projectile, Meta = (ClampMin = 0, ForceUnits = "s"))
+	float SimulationLifeSpan{3.0f};
 
+public:
 	UFUNCTION(BlueprintCallable)
 	// 発射物の発射方向の速度を初期化する関数。
 	void FireInDirection(const FVector& ShootDirection);
+
+	UCapsuleComponent* GetCollisionComponent() const;
+
+	UProjectileMovementComponent* GetProjectileMovement() const;
+
+	float GetSimulationLifeSpan() const;
 };
+
+inline UCapsuleComponent* AAlsProjectile::GetCollisionComponent() const
+{
+	return CollisionComponent;
+}
+
+inline UProjectileMovementComponent* AAlsProjectile::GetProjectileMovement() const
+{
+	return ProjectileMovementComponent;
+}
+
+inline float AAlsProjectile::GetSimulationLifeSpan() const
+{
+	return SimulationLifeSpan;
+}
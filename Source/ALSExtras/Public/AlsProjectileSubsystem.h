@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsProjectileSubsystem.generated.h"
+
+class AAlsProjectile;
+
+USTRUCT()
+struct ALSEXTRAS_API FAlsProjectilePool
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AAlsProjectile>> Projectiles;
+};
+
+USTRUCT()
+struct ALSEXTRAS_API FAlsProjectileSimulation
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TObjectPtr<AAlsProjectile> Projectile;
+
+	FVector Location{ForceInit};
+
+	FVector Velocity{ForceInit};
+
+	float RemainingLifeSpan{0.0f};
+};
+
+// Simulates pooled projectiles. Instead of each projectile ticking its own projectile movement component, all projectiles
+// fired through this subsystem are stepped together in a single loop, and finished projectiles are hidden and kept for
+// reuse instead of being destroyed. The projectile movement component of these projectiles only provides the settings,
+// and its OnProjectileBounce and OnProjectileStop events are broadcast as usual.
+UCLASS()
+class ALSEXTRAS_API UAlsProjectileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Transient)
+	TArray<FAlsProjectileSimulation> Simulations;
+
+	UPROPERTY(Transient)
+	TMap<TSubclassOf<AAlsProjectile>, FAlsProjectilePool> Pools;
+
+private:
+	struct FHitEvent
+	{
+		AAlsProjectile* Projectile{nullptr};
+
+		FHitResult Hit;
+
+		FVector Velocity{ForceInit};
+
+		bool bStopped{false};
+	};
+
+	// Hit events are broadcast only after all projectiles have been stepped, so that
+	// projectiles can be safely fired and released from the event handlers.
+	TArray<FHitEvent> PendingHitEvents;
+
+public:
+	virtual void Deinitialize() override;
+
+	virtual bool IsTickable() const override;
+
+	virtual TStatId GetStatId() const override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	// Fires a projectile of the given class, reusing a previously released projectile if there is one.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Projectile Subsystem", Meta = (DeterminesOutputType = "ProjectileClass"))
+	AAlsProjectile* FireProjectile(TSubclassOf<AAlsProjectile> ProjectileClass, const FVector& Location,
+	                               const FVector& Direction, AActor* Owner = nullptr, APawn* Instigator = nullptr);
+
+	// Stops simulating the projectile and returns it to the pool. Does nothing if the projectile isn't being simulated.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Projectile Subsystem")
+	void ReleaseProjectile(AAlsProjectile* Projectile);
+
+private:
+	AAlsProjectile* AcquireProjectile(TSubclassOf<AAlsProjectile> ProjectileClass, const FTransform& Transform,
+	                                  AActor* Owner, APawn* Instigator);
+
+	void DeactivateProjectile(AAlsProjectile* Projectile);
+
+	// Adds the hit events of the step to the pending hit events. Returns true if the projectile has stopped.
+	bool StepSimulation(FAlsProjectileSimulation& Simulation, float DeltaTime, float GravityZ);
+};